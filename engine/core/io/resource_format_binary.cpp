@@ -670,6 +670,13 @@ Error ResourceLoaderBinary::load() {
 		return error;
 	}
 
+	// Start every dependency up front so they load in parallel while the internal resources are parsed.
+	// Only worth it if there's more than one, otherwise the load would just wait on a single worker.
+	ResourceLoader::LoadThreadMode external_thread_mode = ResourceLoader::LOAD_THREAD_FROM_CURRENT;
+	if (use_sub_threads || (ResourceLoader::is_parallel_dependency_loading_enabled() && external_resources.size() > 1)) {
+		external_thread_mode = ResourceLoader::LOAD_THREAD_DISTRIBUTE;
+	}
+
 	for (int i = 0; i < external_resources.size(); i++) {
 		String path = external_resources[i].path;
 
@@ -683,7 +690,7 @@ Error ResourceLoaderBinary::load() {
 		}
 
 		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
-		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
+		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, external_thread_mode, cache_mode_for_external);
 		if (!external_resources[i].load_token.is_valid()) {
 			if (!ResourceLoader::get_abort_on_missing_resources()) {
 				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
@@ -1198,6 +1198,7 @@ DependencyErrorNotify ResourceLoader::dep_err_notify = nullptr;
 
 bool ResourceLoader::create_missing_resources_if_class_unavailable = false;
 bool ResourceLoader::abort_on_missing_resource = true;
+bool ResourceLoader::parallel_dependency_loading = false;
 bool ResourceLoader::timestamp_on_load = false;
 
 thread_local int ResourceLoader::load_nesting = 0;
@@ -146,6 +146,7 @@ private:
 	static DependencyErrorNotify dep_err_notify;
 	static bool abort_on_missing_resource;
 	static bool create_missing_resources_if_class_unavailable;
+	static bool parallel_dependency_loading;
 	static HashMap<String, Vector<String>> translation_remaps;
 	static HashMap<String, String> path_remaps;
 
@@ -250,6 +251,11 @@ public:
 	static void set_abort_on_missing_resources(bool p_abort) { abort_on_missing_resource = p_abort; }
 	static bool get_abort_on_missing_resources() { return abort_on_missing_resource; }
 
+	// When enabled, loaders start all external dependencies of a resource as parallel sub-loads,
+	// even if the resource itself is loaded without sub-threads.
+	static void set_parallel_dependency_loading(bool p_enable) { parallel_dependency_loading = p_enable; }
+	static bool is_parallel_dependency_loading_enabled() { return parallel_dependency_loading; }
+
 	static String path_remap(const String &p_path);
 	static String import_remap(const String &p_path);
 
@@ -34,6 +34,7 @@
 #include "core/core_string_names.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
 
 #include <stdio.h>
 
@@ -68,6 +69,190 @@ void CallQueue::_add_page() {
 	pages_used++;
 }
 
+Mutex CallQueue::producer_mutex;
+
+// Ties a producer buffer to the lifetime of its thread.
+struct CallQueueProducerHandle {
+	CallQueue::ProducerBuffer *buffer = nullptr;
+
+	static void release(CallQueue::ProducerBuffer *p_buffer) {
+		// Called with producer_mutex held. If the queue is gone the buffer is already detached and empty.
+		if (p_buffer->queue) {
+			p_buffer->orphaned = true;
+		} else {
+			memdelete(p_buffer);
+		}
+	}
+
+	~CallQueueProducerHandle() {
+		if (buffer) {
+			MutexLock lock(CallQueue::producer_mutex);
+			release(buffer);
+		}
+	}
+};
+
+static thread_local CallQueueProducerHandle call_queue_producer_handle;
+
+CallQueue::ProducerBuffer *CallQueue::_get_thread_producer() {
+	ProducerBuffer *producer = call_queue_producer_handle.buffer;
+	if (likely(producer && producer->queue == this)) {
+		return producer;
+	}
+
+	MutexLock lock(producer_mutex);
+	if (producer) {
+		// Registered with a queue that no longer exists.
+		CallQueueProducerHandle::release(producer);
+	}
+	producer = memnew(ProducerBuffer);
+	producer->queue = this;
+	producer->next = producers;
+	producers = producer;
+	call_queue_producer_handle.buffer = producer;
+	return producer;
+}
+
+uint8_t *CallQueue::_push_begin(uint32_t p_room_needed, ProducerBuffer *&r_producer) {
+	if (this == MessageQueue::main_singleton && !Thread::is_main_thread()) {
+		ProducerBuffer *producer = _get_thread_producer();
+		producer->lock.lock();
+		if (unlikely(producer->pages_used == 0)) {
+			if (producer->pages.is_empty()) {
+				producer->pages.push_back(allocator->alloc());
+				producer->page_bytes.push_back(0);
+			}
+			producer->page_bytes[0] = 0;
+			producer->pages_used = 1;
+		}
+		if ((producer->page_bytes[producer->pages_used - 1] + p_room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
+			if (producer->pages_used == max_pages) {
+				producer->lock.unlock();
+				return nullptr;
+			}
+			if (producer->pages_used == producer->pages.size()) {
+				producer->pages.push_back(allocator->alloc());
+				producer->page_bytes.push_back(0);
+			}
+			producer->page_bytes[producer->pages_used] = 0;
+			producer->pages_used++;
+		}
+		r_producer = producer;
+		return &producer->pages[producer->pages_used - 1]->data[producer->page_bytes[producer->pages_used - 1]];
+	}
+
+	LOCK_MUTEX;
+
+	_ensure_first_page();
+
+	if ((page_bytes[pages_used - 1] + p_room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
+		if (pages_used == max_pages) {
+			UNLOCK_MUTEX;
+			return nullptr;
+		}
+		_add_page();
+	}
+
+	r_producer = nullptr;
+	return &pages[pages_used - 1]->data[page_bytes[pages_used - 1]];
+}
+
+void CallQueue::_push_end(uint32_t p_room_needed, ProducerBuffer *p_producer) {
+	if (p_producer) {
+		p_producer->page_bytes[p_producer->pages_used - 1] += p_room_needed;
+		producer_bytes.add(p_room_needed);
+		p_producer->lock.unlock();
+		return;
+	}
+
+	page_bytes[pages_used - 1] += p_room_needed;
+	UNLOCK_MUTEX;
+}
+
+bool CallQueue::_merge_producer_buffers() {
+	// Called with the queue mutex held.
+	if (producer_bytes.get() == 0 && !producers) {
+		return false;
+	}
+
+	bool merged = false;
+	MutexLock lock(producer_mutex);
+
+	ProducerBuffer **prev = &producers;
+	while (*prev) {
+		ProducerBuffer *producer = *prev;
+		producer->lock.lock();
+
+		uint32_t pages_needed = 0;
+		for (uint32_t i = 0; i < producer->pages_used; i++) {
+			if (producer->page_bytes[i]) {
+				pages_needed++;
+			}
+		}
+
+		if (pages_needed && pages_used + pages_needed > max_pages) {
+			fprintf(stderr, "Failed appending thread messages. Message queue out of memory. %s\n", error_text.utf8().get_data());
+			pages_needed = 0; // Keep them for the next flush.
+		} else if (pages_needed) {
+			_ensure_first_page();
+			for (uint32_t i = 0; i < producer->pages_used; i++) {
+				uint32_t bytes = producer->page_bytes[i];
+				if (bytes == 0) {
+					continue;
+				}
+
+				// Only the last page can be empty, reuse it so flushing doesn't stop there.
+				if (page_bytes[pages_used - 1] != 0) {
+					_add_page();
+				}
+				SWAP(pages[pages_used - 1], producer->pages[i]);
+				page_bytes[pages_used - 1] = bytes;
+				producer->page_bytes[i] = 0;
+				producer_bytes.sub(bytes);
+			}
+			producer->pages_used = 0;
+			merged = true;
+		}
+
+		producer->lock.unlock();
+
+		if (producer->orphaned && producer->pages_used == 0) {
+			*prev = producer->next;
+			for (Page *page : producer->pages) {
+				allocator->free(page);
+			}
+			memdelete(producer);
+		} else {
+			prev = &producer->next;
+		}
+	}
+
+	return merged;
+}
+
+void CallQueue::_destroy_messages(Page *p_page, uint32_t p_bytes) {
+	uint32_t offset = 0;
+	while (offset < p_bytes) {
+		Message *message = (Message *)&p_page->data[offset];
+
+		uint32_t advance = sizeof(Message);
+		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+			advance += sizeof(Variant) * message->args;
+		}
+
+		offset += advance;
+
+		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
+			Variant *args = (Variant *)(message + 1);
+			for (int k = 0; k < message->args; k++) {
+				args[k].~Variant();
+			}
+		}
+
+		message->~Message();
+	}
+}
+
 Error CallQueue::push_callp(ObjectID p_id, const StringName &p_method, const Variant **p_args, int p_argcount, bool p_show_error) {
 	return push_callablep(Callable(p_id, p_method), p_args, p_argcount, p_show_error);
 }
@@ -89,24 +274,14 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 
 	ERR_FAIL_COND_V_MSG(room_needed > uint32_t(PAGE_SIZE_BYTES), ERR_INVALID_PARAMETER, "Message is too large to fit on a page (" + itos(PAGE_SIZE_BYTES) + " bytes), consider passing less arguments.");
 
-	LOCK_MUTEX;
-
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	ProducerBuffer *producer = nullptr;
+	uint8_t *buffer_end = _push_begin(room_needed, producer);
+	if (unlikely(!buffer_end)) {
+		fprintf(stderr, "Failed method: %s. Message queue out of memory. %s\n", String(p_callable).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = p_argcount;
 	msg->callable = p_callable;
@@ -122,42 +297,30 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 	buffer_end += sizeof(Message);
 
 	for (int i = 0; i < p_argcount; i++) {
-		Variant *v = memnew_placement(buffer_end, Variant);
+		memnew_placement(buffer_end, Variant(*p_args[i]));
 		buffer_end += sizeof(Variant);
-		*v = *p_args[i];
 	}
 
-	page_bytes[pages_used - 1] += room_needed;
-
-	UNLOCK_MUTEX;
+	_push_end(room_needed, producer);
 
 	return OK;
 }
 
 Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
-	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			String type;
-			if (ObjectDB::get_instance(p_id)) {
-				type = ObjectDB::get_instance(p_id)->get_class();
-			}
-			fprintf(stderr, "Failed set: %s: %s target ID: %s. Message queue out of memory. %s\n", type.utf8().get_data(), String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
+	ProducerBuffer *producer = nullptr;
+	uint8_t *buffer_end = _push_begin(room_needed, producer);
+	if (unlikely(!buffer_end)) {
+		String type;
+		if (ObjectDB::get_instance(p_id)) {
+			type = ObjectDB::get_instance(p_id)->get_class();
 		}
-		_add_page();
+		fprintf(stderr, "Failed set: %s: %s target ID: %s. Message queue out of memory. %s\n", type.utf8().get_data(), String(p_prop).utf8().get_data(), itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 	msg->args = 1;
 	msg->callable = Callable(p_id, p_prop);
@@ -165,35 +328,25 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 
 	buffer_end += sizeof(Message);
 
-	Variant *v = memnew_placement(buffer_end, Variant);
-	*v = p_value;
+	memnew_placement(buffer_end, Variant(p_value));
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	_push_end(room_needed, producer);
 
 	return OK;
 }
 
 Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	ERR_FAIL_COND_V(p_notification < 0, ERR_INVALID_PARAMETER);
-	LOCK_MUTEX;
 	uint32_t room_needed = sizeof(Message);
 
-	_ensure_first_page();
-
-	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
-		if (pages_used == max_pages) {
-			fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
-			statistics();
-			UNLOCK_MUTEX;
-			return ERR_OUT_OF_MEMORY;
-		}
-		_add_page();
+	ProducerBuffer *producer = nullptr;
+	uint8_t *buffer_end = _push_begin(room_needed, producer);
+	if (unlikely(!buffer_end)) {
+		fprintf(stderr, "Failed notification: %d target ID: %s. Message queue out of memory. %s\n", p_notification, itos(p_id).utf8().get_data(), error_text.utf8().get_data());
+		statistics();
+		return ERR_OUT_OF_MEMORY;
 	}
 
-	Page *page = pages[pages_used - 1];
-	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
-
 	Message *msg = memnew_placement(buffer_end, Message);
 
 	msg->type = TYPE_NOTIFICATION;
@@ -201,8 +354,7 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	//msg->target;
 	msg->notification = p_notification;
 
-	page_bytes[pages_used - 1] += room_needed;
-	UNLOCK_MUTEX;
+	_push_end(room_needed, producer);
 
 	return OK;
 }
@@ -284,15 +436,17 @@ Error CallQueue::flush() {
 
 	LOCK_MUTEX;
 
-	if (pages.size() == 0) {
-		// Never allocated
+	if (flushing) {
 		UNLOCK_MUTEX;
-		return OK; // Do nothing.
+		return ERR_BUSY;
 	}
 
-	if (flushing) {
+	_merge_producer_buffers();
+
+	if (pages.size() == 0) {
+		// Never allocated
 		UNLOCK_MUTEX;
-		return ERR_BUSY;
+		return OK; // Do nothing.
 	}
 
 	flushing = true;
@@ -300,7 +454,8 @@ Error CallQueue::flush() {
 	uint32_t i = 0;
 	uint32_t offset = 0;
 
-	while (i < pages_used && offset < page_bytes[i]) {
+	// Messages pushed by other threads while flushing are picked up once the current ones run out.
+	while ((i < pages_used && offset < page_bytes[i]) || _merge_producer_buffers()) {
 		Page *page = pages[i];
 
 		//lock on each iteration, so a call can re-add itself to the message queue
@@ -366,36 +521,27 @@ Error CallQueue::flush() {
 void CallQueue::clear() {
 	LOCK_MUTEX;
 
+	{
+		MutexLock lock(producer_mutex);
+		for (ProducerBuffer *producer = producers; producer; producer = producer->next) {
+			producer->lock.lock();
+			for (uint32_t i = 0; i < producer->pages_used; i++) {
+				_destroy_messages(producer->pages[i], producer->page_bytes[i]);
+				producer_bytes.sub(producer->page_bytes[i]);
+				producer->page_bytes[i] = 0;
+			}
+			producer->pages_used = 0;
+			producer->lock.unlock();
+		}
+	}
+
 	if (pages.size() == 0) {
 		UNLOCK_MUTEX;
 		return; // Nothing to clear.
 	}
 
 	for (uint32_t i = 0; i < pages_used; i++) {
-		uint32_t offset = 0;
-		while (offset < page_bytes[i]) {
-			Page *page = pages[i];
-
-			//lock on each iteration, so a call can re-add itself to the message queue
-
-			Message *message = (Message *)&page->data[offset];
-
-			uint32_t advance = sizeof(Message);
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				advance += sizeof(Variant) * message->args;
-			}
-
-			offset += advance;
-
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				Variant *args = (Variant *)(message + 1);
-				for (int k = 0; k < message->args; k++) {
-					args[k].~Variant();
-				}
-			}
-
-			message->~Message();
-		}
+		_destroy_messages(pages[i], page_bytes[i]);
 	}
 
 	pages_used = 1;
@@ -504,6 +650,9 @@ bool CallQueue::is_flushing() const {
 }
 
 bool CallQueue::has_messages() const {
+	if (producer_bytes.get() != 0) {
+		return true;
+	}
 	if (pages_used == 0) {
 		return false;
 	}
@@ -532,6 +681,24 @@ CallQueue::CallQueue(Allocator *p_custom_allocator, uint32_t p_max_pages, const
 
 CallQueue::~CallQueue() {
 	clear();
+	{
+		// Buffers of threads that are still alive are detached, they free themselves when the thread exits.
+		MutexLock lock(producer_mutex);
+		while (producers) {
+			ProducerBuffer *producer = producers;
+			producers = producer->next;
+			for (Page *page : producer->pages) {
+				allocator->free(page);
+			}
+			producer->pages.clear();
+			producer->page_bytes.clear();
+			if (producer->orphaned) {
+				memdelete(producer);
+			} else {
+				producer->queue = nullptr;
+			}
+		}
+	}
 	// Let go of pages.
 	for (uint32_t i = 0; i < pages.size(); i++) {
 		allocator->free(pages[i]);
@@ -32,9 +32,11 @@
 #define MESSAGE_QUEUE_H
 
 #include "core/object/object_id.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread_safe.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "core/variant/variant.h"
 
 class Object;
@@ -68,6 +70,26 @@ private:
 
 	Mutex mutex;
 
+	// Threads other than the main one push into the main queue through their own producer buffer,
+	// so they don't contend on the queue mutex. Buffers are merged on flush by moving their pages
+	// over, which keeps each producer's messages in order and avoids copying them again.
+	struct ProducerBuffer {
+		SpinLock lock;
+		CallQueue *queue = nullptr;
+		bool orphaned = false; // The owning thread exited, free after merging.
+		LocalVector<Page *> pages;
+		LocalVector<uint32_t> page_bytes;
+		uint32_t pages_used = 0;
+		ProducerBuffer *next = nullptr;
+	};
+
+	// Registration, thread exit and queue destruction are rare, so a single mutex guards all lists.
+	static Mutex producer_mutex;
+	ProducerBuffer *producers = nullptr;
+	SafeNumeric<uint32_t> producer_bytes;
+
+	friend struct CallQueueProducerHandle;
+
 	Allocator *allocator = nullptr;
 	bool allocator_is_custom = false;
 
@@ -102,6 +124,14 @@ private:
 
 	void _add_page();
 
+	ProducerBuffer *_get_thread_producer();
+	bool _merge_producer_buffers();
+	void _destroy_messages(Page *p_page, uint32_t p_bytes);
+
+	// Returns where the message should be written, with the matching lock held. On failure nothing is locked.
+	uint8_t *_push_begin(uint32_t p_room_needed, ProducerBuffer *&r_producer);
+	void _push_end(uint32_t p_room_needed, ProducerBuffer *p_producer);
+
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
 
 	String error_text;
@@ -2135,15 +2135,20 @@ void postinitialize_handler(Object *p_object) {
 }
 
 void ObjectDB::debug_objects(DebugFunc p_func) {
-	spin_lock.lock();
-
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
+	page_lock.lock();
+	uint32_t max = slot_max;
+	page_lock.unlock();
+
+	for (uint32_t i = 0, count = slot_count.get(); i < max && count != 0; i++) {
+		ObjectSlot &object_slot = _get_slot(i);
+		if (object_slot.validator.load(std::memory_order_acquire)) {
+			Object *object = object_slot.object.load(std::memory_order_acquire);
+			if (object) {
+				p_func(object);
+			}
 			count--;
 		}
 	}
-	spin_lock.unlock();
 }
 
 #ifdef TOOLS_ENABLED
@@ -2192,46 +2197,124 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 }
 #endif
 
-SpinLock ObjectDB::spin_lock;
-uint32_t ObjectDB::slot_count = 0;
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::slot_pages[OBJECTDB_MAX_PAGES] = {};
+SpinLock ObjectDB::page_lock;
 uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
-uint64_t ObjectDB::validator_counter = 0;
+SafeNumeric<uint32_t> ObjectDB::slot_count;
+SafeNumeric<uint64_t> ObjectDB::validator_counter;
+
+// Free slots are spread over a few shards so threads creating and freeing objects at the same time
+// don't fight over a single lock. Each thread uses its own shard, and refills it in batches from the
+// other shards or from freshly allocated slots once it runs dry.
+#define OBJECTDB_FREE_SLOT_SHARDS 8
+#define OBJECTDB_FREE_SLOT_BATCH 64
+
+struct alignas(64) ObjectDBFreeSlotShard {
+	SpinLock lock;
+	LocalVector<uint32_t> free_slots;
+};
+
+static ObjectDBFreeSlotShard objectdb_free_slot_shards[OBJECTDB_FREE_SLOT_SHARDS];
+static SafeNumeric<uint32_t> objectdb_shard_counter;
+static thread_local uint32_t objectdb_thread_shard = UINT32_MAX;
+
+static _FORCE_INLINE_ ObjectDBFreeSlotShard &_get_thread_free_slot_shard() {
+	if (unlikely(objectdb_thread_shard == UINT32_MAX)) {
+		objectdb_thread_shard = objectdb_shard_counter.postincrement() % OBJECTDB_FREE_SLOT_SHARDS;
+	}
+	return objectdb_free_slot_shards[objectdb_thread_shard];
+}
 
 int ObjectDB::get_object_count() {
-	return slot_count;
+	return slot_count.get();
 }
 
-ObjectID ObjectDB::add_instance(Object *p_object) {
-	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
-		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
+uint32_t ObjectDB::_alloc_slot() {
+	ObjectDBFreeSlotShard &shard = _get_thread_free_slot_shard();
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+	shard.lock.lock();
+	if (likely(!shard.free_slots.is_empty())) {
+		uint32_t slot = shard.free_slots[shard.free_slots.size() - 1];
+		shard.free_slots.resize(shard.free_slots.size() - 1);
+		shard.lock.unlock();
+		return slot;
+	}
+	shard.lock.unlock();
+
+	// Only one shard lock is held at a time, so refilling can't deadlock against other threads doing the same.
+	uint32_t batch[OBJECTDB_FREE_SLOT_BATCH];
+	uint32_t batch_size = 0;
+
+	for (uint32_t i = 0; i < OBJECTDB_FREE_SLOT_SHARDS && batch_size == 0; i++) {
+		ObjectDBFreeSlotShard &other = objectdb_free_slot_shards[i];
+		if (&other == &shard) {
+			continue;
 		}
-		slot_max = new_slot_max;
+		other.lock.lock();
+		uint32_t available = other.free_slots.size();
+		batch_size = MIN((available + 1) / 2, uint32_t(OBJECTDB_FREE_SLOT_BATCH));
+		for (uint32_t j = 0; j < batch_size; j++) {
+			batch[j] = other.free_slots[available - j - 1];
+		}
+		other.free_slots.resize(available - batch_size);
+		other.lock.unlock();
+	}
+
+	if (batch_size == 0) {
+		page_lock.lock();
+		CRASH_COND_MSG(slot_max == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS), "ObjectDB ran out of instance slots.");
+		batch_size = MIN(uint32_t(OBJECTDB_FREE_SLOT_BATCH), (1 << OBJECTDB_SLOT_MAX_COUNT_BITS) - slot_max);
+		for (uint32_t i = 0; i < batch_size; i++) {
+			uint32_t slot = slot_max + i;
+			uint32_t page = slot >> OBJECTDB_PAGE_BITS;
+			if (slot_pages[page].load(std::memory_order_relaxed) == nullptr) {
+				ObjectSlot *new_page = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * OBJECTDB_PAGE_SIZE);
+				for (uint32_t j = 0; j < OBJECTDB_PAGE_SIZE; j++) {
+					memnew_placement(&new_page[j], ObjectSlot);
+				}
+				slot_pages[page].store(new_page, std::memory_order_release);
+			}
+			// Hand out the lowest slots first.
+			batch[batch_size - i - 1] = slot;
+		}
+		slot_max += batch_size;
+		page_lock.unlock();
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
-		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+	uint32_t slot = batch[batch_size - 1];
+	if (batch_size > 1) {
+		shard.lock.lock();
+		for (uint32_t i = 0; i < batch_size - 1; i++) {
+			shard.free_slots.push_back(batch[i]);
+		}
+		shard.lock.unlock();
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
-	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
-	if (unlikely(validator_counter == 0)) {
-		validator_counter = 1;
+	return slot;
+}
+
+void ObjectDB::_free_slot(uint32_t p_slot) {
+	ObjectDBFreeSlotShard &shard = _get_thread_free_slot_shard();
+	shard.lock.lock();
+	shard.free_slots.push_back(p_slot);
+	shard.lock.unlock();
+}
+
+ObjectID ObjectDB::add_instance(Object *p_object) {
+	uint32_t slot = _alloc_slot();
+	ObjectSlot &object_slot = _get_slot(slot);
+
+	ERR_FAIL_COND_V(object_slot.object.load(std::memory_order_relaxed) != nullptr, ObjectID());
+
+	uint64_t validator = validator_counter.increment() & OBJECTDB_VALIDATOR_MASK;
+	if (unlikely(validator == 0)) {
+		validator = validator_counter.increment() & OBJECTDB_VALIDATOR_MASK;
 	}
-	object_slots[slot].validator = validator_counter;
 
-	uint64_t id = validator_counter;
+	object_slot.is_ref_counted = p_object->is_ref_counted();
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.validator.store(validator, std::memory_order_release);
+
+	uint64_t id = validator;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
 	id |= uint64_t(slot);
 
@@ -2239,9 +2322,7 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
-	slot_count++;
-
-	spin_lock.unlock();
+	slot_count.increment();
 
 	return ObjectID(id);
 }
@@ -2249,34 +2330,26 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 void ObjectDB::remove_instance(Object *p_object) {
 	uint64_t t = p_object->get_instance_id();
 	uint32_t slot = t & OBJECTDB_SLOT_MAX_COUNT_MASK; //slot is always valid on valid object
-
-	spin_lock.lock();
+	ObjectSlot &object_slot = _get_slot(slot);
 
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
-		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
-	}
+	ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
-		}
+		ERR_FAIL_COND(object_slot.validator.load(std::memory_order_relaxed) != validator);
 	}
 
 #endif
-	//decrease slot count
-	slot_count--;
-	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
+	//clear the object first, readers still matching the old validator will see it as gone
+	object_slot.object.store(nullptr, std::memory_order_release);
 	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	object_slot.validator.store(0, std::memory_order_release);
+	object_slot.is_ref_counted = false;
 
-	spin_lock.unlock();
+	slot_count.decrement();
+
+	_free_slot(slot);
 }
 
 void ObjectDB::setup() {
@@ -2284,8 +2357,8 @@ void ObjectDB::setup() {
 }
 
 void ObjectDB::cleanup() {
-	if (slot_count > 0) {
-		spin_lock.lock();
+	if (slot_count.get() > 0) {
+		page_lock.lock();
 
 		WARN_PRINT("ObjectDB instances leaked at exit (run with --verbose for details).");
 		if (OS::get_singleton()->is_stdout_verbose()) {
@@ -2296,9 +2369,11 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0, count = slot_count.get(); i < slot_max && count != 0; i++) {
+				ObjectSlot &object_slot = _get_slot(i);
+				uint64_t validator = object_slot.validator.load(std::memory_order_acquire);
+				if (validator) {
+					Object *obj = object_slot.object.load(std::memory_order_acquire);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2308,7 +2383,7 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = uint64_t(i) | (validator << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slot.is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
 
@@ -2317,10 +2392,18 @@ void ObjectDB::cleanup() {
 			}
 			print_line("Hint: Leaked instances typically happen when nodes are removed from the scene tree (with `remove_child()`) but not freed (with `free()` or `queue_free()`).");
 		}
-		spin_lock.unlock();
+		page_lock.unlock();
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < OBJECTDB_MAX_PAGES; i++) {
+		ObjectSlot *page = slot_pages[i].load(std::memory_order_acquire);
+		if (page) {
+			memfree(page);
+			slot_pages[i].store(nullptr, std::memory_order_release);
+		}
+	}
+	slot_max = 0;
+	for (uint32_t i = 0; i < OBJECTDB_FREE_SLOT_SHARDS; i++) {
+		objectdb_free_slot_shards[i].free_slots.reset();
 	}
 }
@@ -44,6 +44,8 @@
 #include "core/variant/callable_bind.h"
 #include "core/variant/variant.h"
 
+#include <atomic>
+
 template <typename T>
 class TypedArray;
 
@@ -1011,23 +1013,35 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
-	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+#define OBJECTDB_PAGE_BITS 12
+#define OBJECTDB_PAGE_SIZE (1 << OBJECTDB_PAGE_BITS)
+#define OBJECTDB_PAGE_MASK (OBJECTDB_PAGE_SIZE - 1)
+#define OBJECTDB_MAX_PAGES (1 << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_PAGE_BITS))
+
+	// Slots are stored in pages that never move until cleanup, so get_instance can read them without
+	// locking. The object is published before the validator, and cleared before the validator is.
+	struct ObjectSlot {
+		std::atomic<uint64_t> validator = { 0 };
+		std::atomic<Object *> object = { nullptr };
+		bool is_ref_counted = false;
 	};
 
-	static SpinLock spin_lock;
-	static uint32_t slot_count;
+	static std::atomic<ObjectSlot *> slot_pages[OBJECTDB_MAX_PAGES];
+	static SpinLock page_lock;
 	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
-	static uint64_t validator_counter;
+	static SafeNumeric<uint32_t> slot_count;
+	static SafeNumeric<uint64_t> validator_counter;
 
 	friend class Object;
 	friend void unregister_core_types();
 	static void cleanup();
 
+	static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return slot_pages[p_slot >> OBJECTDB_PAGE_BITS].load(std::memory_order_acquire)[p_slot & OBJECTDB_PAGE_MASK];
+	}
+	static uint32_t _alloc_slot();
+	static void _free_slot(uint32_t p_slot);
+
 	static ObjectID add_instance(Object *p_object);
 	static void remove_instance(Object *p_object);
 
@@ -1041,20 +1055,22 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		ObjectSlot *page = slot_pages[slot >> OBJECTDB_PAGE_BITS].load(std::memory_order_acquire);
+		ERR_FAIL_NULL_V(page, nullptr); // This should never happen unless RID is corrupted.
 
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
+		ObjectSlot &object_slot = page[slot & OBJECTDB_PAGE_MASK];
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		if (unlikely(object_slot.validator.load(std::memory_order_acquire) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The slot may have been freed and reused by another thread in between.
+		if (unlikely(object_slot.validator.load(std::memory_order_relaxed) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
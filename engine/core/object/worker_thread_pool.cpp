@@ -165,11 +165,28 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 #endif
 }
 
+WorkerThreadPool::Task *WorkerThreadPool::_pop_local_task(ThreadData *p_thread_data) {
+	Task *task = nullptr;
+	if (p_thread_data->work_queue.pop(task)) {
+		return task;
+	}
+
+	// Steal from the other pool threads, starting from the next one to spread the load.
+	uint32_t thread_count = threads.size();
+	for (uint32_t i = 1; i < thread_count; i++) {
+		if (threads[(p_thread_data->index + i) % thread_count].work_queue.steal(task)) {
+			return task;
+		}
+	}
+	return nullptr;
+}
+
 void WorkerThreadPool::_thread_function(void *p_user) {
 	ThreadData *thread_data = (ThreadData *)p_user;
 	while (true) {
-		Task *task_to_process = nullptr;
-		{
+		// Work queues don't need the lock, so try them first.
+		Task *task_to_process = singleton->_pop_local_task(thread_data);
+		if (!task_to_process) {
 			MutexLock lock(singleton->task_mutex);
 			if (singleton->exit_threads) {
 				return;
@@ -180,8 +197,17 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 				task_to_process = singleton->task_queue.first()->self();
 				singleton->task_queue.remove(singleton->task_queue.first());
 			} else {
-				thread_data->cond_var.wait(lock);
-				DEV_ASSERT(singleton->exit_threads || thread_data->signaled);
+				// Announce this thread is going idle before checking the work queues one last time.
+				// Paired with the fence in _post_tasks_and_unlock(), either the posting thread sees
+				// us idle and notifies, or we see its task here.
+				singleton->idle_threads.increment();
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				task_to_process = singleton->_pop_local_task(thread_data);
+				if (!task_to_process) {
+					thread_data->cond_var.wait(lock);
+					DEV_ASSERT(singleton->exit_threads || thread_data->signaled);
+				}
+				singleton->idle_threads.decrement();
 			}
 		}
 
@@ -204,11 +230,27 @@ void WorkerThreadPool::_post_tasks_and_unlock(Task **p_tasks, uint32_t p_count,
 		return;
 	}
 
+	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
+
+	if (p_high_priority && caller_pool_thread) {
+		// Pool threads keep the high priority tasks they post in their own work queue,
+		// where they will pick them up depth-first and other threads can steal them.
+		task_mutex.unlock();
+		for (uint32_t i = 0; i < p_count; i++) {
+			p_tasks[i]->low_priority = false;
+			caller_pool_thread->work_queue.push(p_tasks[i]);
+		}
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (idle_threads.get() > 0) {
+			MutexLock lock(task_mutex);
+			_notify_threads(caller_pool_thread, p_count, 0);
+		}
+		return;
+	}
+
 	uint32_t to_process = 0;
 	uint32_t to_promote = 0;
 
-	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
-
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
@@ -428,24 +470,35 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 						}
 					}
 
-					if (singleton->task_queue.first()) {
+					// Our own work queue first, the awaited task is likely to be there.
+					task_to_process = _pop_local_task(caller_pool_thread);
+
+					if (!task_to_process && singleton->task_queue.first()) {
 						task_to_process = task_queue.first()->self();
 						task_queue.remove(task_queue.first());
 					}
 
 					if (!task_to_process) {
-						caller_pool_thread->awaited_task = task;
-
-						if (flushing_cmd_queue) {
-							flushing_cmd_queue->unlock();
+						// See _thread_function() for the idle handshake.
+						idle_threads.increment();
+						std::atomic_thread_fence(std::memory_order_seq_cst);
+						task_to_process = _pop_local_task(caller_pool_thread);
+
+						if (!task_to_process) {
+							caller_pool_thread->awaited_task = task;
+
+							if (flushing_cmd_queue) {
+								flushing_cmd_queue->unlock();
+							}
+							caller_pool_thread->cond_var.wait(lock);
+							if (flushing_cmd_queue) {
+								flushing_cmd_queue->lock();
+							}
+
+							DEV_ASSERT(exit_threads || caller_pool_thread->signaled || task->completed);
+							caller_pool_thread->awaited_task = nullptr;
 						}
-						caller_pool_thread->cond_var.wait(lock);
-						if (flushing_cmd_queue) {
-							flushing_cmd_queue->lock();
-						}
-
-						DEV_ASSERT(exit_threads || caller_pool_thread->signaled || task->completed);
-						caller_pool_thread->awaited_task = nullptr;
+						idle_threads.decrement();
 					}
 				}
 			}
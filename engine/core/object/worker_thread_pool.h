@@ -40,6 +40,7 @@
 #include "core/templates/paged_allocator.h"
 #include "core/templates/rid.h"
 #include "core/templates/safe_refcount.h"
+#include "core/templates/work_stealing_queue.h"
 
 class CommandQueueMT;
 
@@ -114,10 +115,15 @@ private:
 		Task *current_task = nullptr;
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable. Special value for idle-waiting.
 		ConditionVariable cond_var;
+		// High priority tasks posted from this thread. Only this thread pushes and pops, others steal.
+		WorkStealingQueue<Task *> work_queue;
 	};
 
 	TightLocalVector<ThreadData> threads;
 	bool exit_threads = false;
+	// Pool threads about to wait on their condition variable. Lets threads posting to their
+	// own work queue skip locking task_mutex when there's no one to wake up.
+	SafeNumeric<uint32_t> idle_threads;
 
 	HashMap<Thread::ID, int> thread_ids;
 	HashMap<
@@ -145,6 +151,7 @@ private:
 
 	void _process_task(Task *task);
 
+	Task *_pop_local_task(ThreadData *p_thread_data);
 	void _post_tasks_and_unlock(Task **p_tasks, uint32_t p_count, bool p_high_priority);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
@@ -0,0 +1,170 @@
+/**************************************************************************/
+/*  frame_arena.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+#include "frame_arena.h"
+
+#include "core/templates/safe_refcount.h"
+
+static constexpr size_t FRAME_ARENA_CHUNK_SIZE = 256 * 1024;
+
+struct FrameArenaChunk {
+	FrameArenaChunk *next = nullptr;
+	size_t size = 0;
+	size_t used = 0;
+
+	_FORCE_INLINE_ uint8_t *get_data() {
+		return reinterpret_cast<uint8_t *>(this) + sizeof(FrameArenaChunk);
+	}
+};
+
+struct FrameArenaThreadData {
+	FrameArenaChunk *first = nullptr;
+	FrameArenaChunk *current = nullptr;
+	uintptr_t cursor = 0;
+	uintptr_t end = 0;
+	uint8_t *last_alloc = nullptr;
+	uint64_t frame = 0;
+	uint64_t frame_used = 0;
+
+	~FrameArenaThreadData() {
+		FrameArenaChunk *chunk = first;
+		while (chunk) {
+			FrameArenaChunk *next = chunk->next;
+			memfree(chunk);
+			chunk = next;
+		}
+	}
+};
+
+static SafeNumeric<uint64_t> frame_arena_frame;
+static SafeNumeric<uint64_t> frame_arena_high_water_mark;
+static thread_local FrameArenaThreadData frame_arena_thread_data;
+
+static void _frame_arena_rewind(FrameArenaThreadData &r_data, uint64_t p_frame) {
+	frame_arena_high_water_mark.exchange_if_greater(r_data.frame_used);
+
+	if (r_data.current) {
+		r_data.current->used = r_data.cursor - uintptr_t(r_data.current->get_data());
+#ifdef DEBUG_ENABLED
+		// Anything still pointing in here reads garbage instead of stale but plausible data.
+		for (FrameArenaChunk *chunk = r_data.first; chunk != r_data.current->next; chunk = chunk->next) {
+			memset(chunk->get_data(), 0xCD, chunk->used);
+		}
+#endif
+		r_data.current = r_data.first;
+		r_data.cursor = uintptr_t(r_data.first->get_data());
+		r_data.end = r_data.cursor + r_data.first->size;
+	}
+
+	r_data.last_alloc = nullptr;
+	r_data.frame = p_frame;
+	r_data.frame_used = 0;
+}
+
+static void _frame_arena_next_chunk(FrameArenaThreadData &r_data, size_t p_bytes, size_t p_alignment) {
+	if (r_data.current) {
+		r_data.current->used = r_data.cursor - uintptr_t(r_data.current->get_data());
+	}
+
+	// Reuse the chunk from previous frames if it fits, otherwise put a new one in front of it.
+	FrameArenaChunk *next = r_data.current ? r_data.current->next : r_data.first;
+	if (!next || next->size < p_bytes + p_alignment) {
+		const size_t size = MAX(FRAME_ARENA_CHUNK_SIZE, p_bytes + p_alignment);
+		FrameArenaChunk *chunk = memnew_placement(memalloc(sizeof(FrameArenaChunk) + size), FrameArenaChunk);
+		chunk->size = size;
+		chunk->next = next;
+		if (r_data.current) {
+			r_data.current->next = chunk;
+		} else {
+			r_data.first = chunk;
+		}
+		next = chunk;
+	}
+
+	next->used = 0;
+	r_data.current = next;
+	r_data.cursor = uintptr_t(next->get_data());
+	r_data.end = r_data.cursor + next->size;
+}
+
+void *FrameArena::alloc(size_t p_bytes, size_t p_alignment) {
+	FrameArenaThreadData &data = frame_arena_thread_data;
+
+	const uint64_t frame = frame_arena_frame.get();
+	if (unlikely(data.frame != frame)) {
+		_frame_arena_rewind(data, frame);
+	}
+
+	uintptr_t mem = (data.cursor + p_alignment - 1) & ~uintptr_t(p_alignment - 1);
+	if (unlikely(data.current == nullptr || mem + p_bytes > data.end)) {
+		_frame_arena_next_chunk(data, p_bytes, p_alignment);
+		mem = (data.cursor + p_alignment - 1) & ~uintptr_t(p_alignment - 1);
+	}
+
+	data.frame_used += mem + p_bytes - data.cursor;
+	data.cursor = mem + p_bytes;
+	data.last_alloc = reinterpret_cast<uint8_t *>(mem);
+	return data.last_alloc;
+}
+
+void *FrameArena::realloc(void *p_memory, size_t p_old_bytes, size_t p_bytes) {
+	if (p_memory == nullptr) {
+		return alloc(p_bytes);
+	}
+
+	FrameArenaThreadData &data = frame_arena_thread_data;
+	if (p_memory == data.last_alloc && data.frame == frame_arena_frame.get()) {
+		const uintptr_t mem = uintptr_t(p_memory);
+		if (mem + p_bytes <= data.end) {
+			data.frame_used = data.frame_used + p_bytes - (data.cursor - mem);
+			data.cursor = mem + p_bytes;
+			return p_memory;
+		}
+	} else if (p_bytes <= p_old_bytes) {
+		return p_memory;
+	}
+
+	void *new_memory = alloc(p_bytes);
+	memcpy(new_memory, p_memory, MIN(p_old_bytes, p_bytes));
+	return new_memory;
+}
+
+void FrameArena::begin_frame() {
+	const uint64_t frame = frame_arena_frame.increment();
+	// The calling thread rewinds right away, the rest do it on their next allocation.
+	_frame_arena_rewind(frame_arena_thread_data, frame);
+}
+
+uint64_t FrameArena::get_frame() {
+	return frame_arena_frame.get();
+}
+
+uint64_t FrameArena::get_high_water_mark() {
+	return frame_arena_high_water_mark.get();
+}
@@ -0,0 +1,65 @@
+/**************************************************************************/
+/*  frame_arena.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include "core/templates/local_vector.h"
+
+// Linear allocator for data that only lives until the end of the current frame.
+// Every thread bumps allocations out of its own chunks, Main::iteration calls begin_frame() and each
+// thread rewinds its arena the next time it allocates. Nothing is freed individually.
+//
+// Memory from the arena must not be kept across a frame boundary, this includes containers using it
+// and tasks that keep running after the frame ends. Debug builds poison the rewound memory.
+class FrameArena {
+public:
+	static void *alloc(size_t p_bytes, size_t p_alignment = alignof(max_align_t));
+	// Grows in place when p_memory is the last allocation of this thread's arena.
+	static void *realloc(void *p_memory, size_t p_old_bytes, size_t p_bytes);
+	_FORCE_INLINE_ static void free(void *p_memory) {}
+
+	template <typename T>
+	_FORCE_INLINE_ static T *alloc_array(size_t p_count) {
+		static_assert(std::is_trivially_destructible_v<T>, "Destructors of frame arena allocations are never called.");
+		return static_cast<T *>(alloc(sizeof(T) * p_count, alignof(T)));
+	}
+
+	static void begin_frame();
+	static uint64_t get_frame();
+
+	// Most memory used by a single thread's arena in one frame so far.
+	static uint64_t get_high_water_mark();
+};
+
+// LocalVector backed by the calling thread's frame arena.
+template <typename T, typename U = uint32_t, bool force_trivial = false>
+using FrameLocalVector = LocalVector<T, U, force_trivial, false, FrameArena>;
+
+#endif // FRAME_ARENA_H
@@ -31,11 +31,22 @@
 #include "memory.h"
 
 #include "core/error/error_macros.h"
+#include "core/os/thread_cache_allocator.h"
 #include "core/templates/safe_refcount.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 
+#ifdef THREAD_CACHE_ALLOCATOR_ENABLED
+#define MEMORY_MALLOC(m_size) ThreadCacheAllocator::alloc(m_size)
+#define MEMORY_REALLOC(m_mem, m_size) ThreadCacheAllocator::realloc(m_mem, m_size)
+#define MEMORY_FREE(m_mem) ThreadCacheAllocator::free(m_mem)
+#else
+#define MEMORY_MALLOC(m_size) malloc(m_size)
+#define MEMORY_REALLOC(m_mem, m_size) realloc(m_mem, m_size)
+#define MEMORY_FREE(m_mem) free(m_mem)
+#endif
+
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
 }
@@ -61,6 +72,24 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
+
+void Memory::_add_mem_usage(uint64_t p_bytes) {
+#ifdef THREAD_CACHE_ALLOCATOR_ENABLED
+	// Counted per thread, a shared counter would bounce between all the threads allocating.
+	ThreadCacheAllocator::add_usage(p_bytes);
+#else
+	uint64_t new_mem_usage = mem_usage.add(p_bytes);
+	max_usage.exchange_if_greater(new_mem_usage);
+#endif
+}
+
+void Memory::_sub_mem_usage(uint64_t p_bytes) {
+#ifdef THREAD_CACHE_ALLOCATOR_ENABLED
+	ThreadCacheAllocator::add_usage(-int64_t(p_bytes));
+#else
+	mem_usage.sub(p_bytes);
+#endif
+}
 #endif
 
 SafeNumeric<uint64_t> Memory::alloc_count;
@@ -72,11 +101,13 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
-	void *mem = malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+	void *mem = MEMORY_MALLOC(p_bytes + (prepad ? DATA_OFFSET : 0));
 
 	ERR_FAIL_NULL_V(mem, nullptr);
 
+#ifndef THREAD_CACHE_ALLOCATOR_ENABLED
 	alloc_count.increment();
+#endif
 
 	if (prepad) {
 		uint8_t *s8 = (uint8_t *)mem;
@@ -85,8 +116,7 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 		*s = p_bytes;
 
 #ifdef DEBUG_ENABLED
-		uint64_t new_mem_usage = mem_usage.add(p_bytes);
-		max_usage.exchange_if_greater(new_mem_usage);
+		_add_mem_usage(p_bytes);
 #endif
 		return s8 + DATA_OFFSET;
 	} else {
@@ -113,20 +143,19 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 
 #ifdef DEBUG_ENABLED
 		if (p_bytes > *s) {
-			uint64_t new_mem_usage = mem_usage.add(p_bytes - *s);
-			max_usage.exchange_if_greater(new_mem_usage);
+			_add_mem_usage(p_bytes - *s);
 		} else {
-			mem_usage.sub(*s - p_bytes);
+			_sub_mem_usage(*s - p_bytes);
 		}
 #endif
 
 		if (p_bytes == 0) {
-			free(mem);
+			MEMORY_FREE(mem);
 			return nullptr;
 		} else {
 			*s = p_bytes;
 
-			mem = (uint8_t *)realloc(mem, p_bytes + DATA_OFFSET);
+			mem = (uint8_t *)MEMORY_REALLOC(mem, p_bytes + DATA_OFFSET);
 			ERR_FAIL_NULL_V(mem, nullptr);
 
 			s = (uint64_t *)(mem + SIZE_OFFSET);
@@ -136,7 +165,7 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 			return mem + DATA_OFFSET;
 		}
 	} else {
-		mem = (uint8_t *)realloc(mem, p_bytes);
+		mem = (uint8_t *)MEMORY_REALLOC(mem, p_bytes);
 
 		ERR_FAIL_COND_V(mem == nullptr && p_bytes > 0, nullptr);
 
@@ -155,19 +184,21 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
+#ifndef THREAD_CACHE_ALLOCATOR_ENABLED
 	alloc_count.decrement();
+#endif
 
 	if (prepad) {
 		mem -= DATA_OFFSET;
 
 #ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
-		mem_usage.sub(*s);
+		_sub_mem_usage(*s);
 #endif
 
-		free(mem);
+		MEMORY_FREE(mem);
 	} else {
-		free(mem);
+		MEMORY_FREE(mem);
 	}
 }
 
@@ -176,7 +207,9 @@ uint64_t Memory::get_mem_available() {
 }
 
 uint64_t Memory::get_mem_usage() {
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) && defined(THREAD_CACHE_ALLOCATOR_ENABLED)
+	return ThreadCacheAllocator::get_usage();
+#elif defined(DEBUG_ENABLED)
 	return mem_usage.get();
 #else
 	return 0;
@@ -184,7 +217,9 @@ uint64_t Memory::get_mem_usage() {
 }
 
 uint64_t Memory::get_mem_max_usage() {
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) && defined(THREAD_CACHE_ALLOCATOR_ENABLED)
+	return ThreadCacheAllocator::get_max_usage();
+#elif defined(DEBUG_ENABLED)
 	return max_usage.get();
 #else
 	return 0;
@@ -42,6 +42,9 @@ class Memory {
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> mem_usage;
 	static SafeNumeric<uint64_t> max_usage;
+
+	static void _add_mem_usage(uint64_t p_bytes);
+	static void _sub_mem_usage(uint64_t p_bytes);
 #endif
 
 	static SafeNumeric<uint64_t> alloc_count;
@@ -70,6 +73,7 @@ public:
 class DefaultAllocator {
 public:
 	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return Memory::alloc_static(p_memory, false); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_old_memory, size_t p_memory) { return Memory::realloc_static(p_ptr, p_memory, false); }
 	_FORCE_INLINE_ static void free(void *p_ptr) { Memory::free_static(p_ptr, false); }
 };
 
@@ -0,0 +1,391 @@
+/**************************************************************************/
+/*  thread_cache_allocator.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+#include "thread_cache_allocator.h"
+
+#include "core/os/spin_lock.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <new>
+
+// Nothing in here may allocate through Memory, the error macros included.
+
+namespace {
+
+constexpr uint32_t SIZE_CLASS_COUNT = 28;
+constexpr uint32_t LARGE_SIZE_CLASS = UINT32_MAX;
+constexpr size_t SPAN_SIZE = 64 * 1024;
+constexpr uint32_t REMOTE_BATCH_SIZE = 32;
+
+struct ThreadCache;
+
+// Placed right before every block returned to the caller, keeps the payload aligned to max_align_t.
+struct alignas(alignof(max_align_t)) BlockHeader {
+	union {
+		ThreadCache *owner;
+		size_t large_size;
+	};
+	uint32_t size_class;
+};
+
+constexpr size_t HEADER_SIZE = sizeof(BlockHeader);
+static_assert(HEADER_SIZE % alignof(max_align_t) == 0);
+
+// Stored in the payload of free blocks.
+struct FreeBlock {
+	FreeBlock *next;
+};
+
+struct SizeClasses {
+	uint32_t sizes[SIZE_CLASS_COUNT] = {};
+	uint8_t lookup[ThreadCacheAllocator::MAX_SMALL_SIZE / 16 + 1] = {};
+
+	constexpr SizeClasses() {
+		// 16 byte steps up to 128 bytes, four steps per power of two after that.
+		uint32_t count = 0;
+		for (uint32_t size = 16; size <= 128; size += 16) {
+			sizes[count++] = size;
+		}
+		for (uint32_t base = 128; base < ThreadCacheAllocator::MAX_SMALL_SIZE; base *= 2) {
+			for (uint32_t step = 1; step <= 4; step++) {
+				sizes[count++] = base + base / 4 * step;
+			}
+		}
+
+		uint32_t size_class = 0;
+		for (uint32_t i = 0; i <= ThreadCacheAllocator::MAX_SMALL_SIZE / 16; i++) {
+			while (sizes[size_class] < i * 16) {
+				size_class++;
+			}
+			lookup[i] = size_class;
+		}
+	}
+};
+
+constexpr SizeClasses size_classes;
+static_assert(size_classes.sizes[SIZE_CLASS_COUNT - 1] == ThreadCacheAllocator::MAX_SMALL_SIZE);
+
+struct ThreadCache {
+	FreeBlock *free_lists[SIZE_CLASS_COUNT] = {};
+	uint8_t *span_cursors[SIZE_CLASS_COUNT] = {};
+	uint8_t *span_ends[SIZE_CLASS_COUNT] = {};
+
+	// Blocks owned by this cache that were freed by other threads.
+	std::atomic<FreeBlock *> remote_frees = { nullptr };
+
+	// Blocks owned by another cache that were freed by this thread, handed back all at once.
+	ThreadCache *remote_batch_owner = nullptr;
+	FreeBlock *remote_batch_head = nullptr;
+	FreeBlock *remote_batch_tail = nullptr;
+	uint32_t remote_batch_count = 0;
+
+	// Only ever written by the thread that currently uses this cache.
+	std::atomic<int64_t> usage = { 0 };
+
+	ThreadCache *next = nullptr;
+	ThreadCache *next_orphan = nullptr;
+};
+
+SpinLock caches_lock;
+ThreadCache *caches = nullptr;
+ThreadCache *orphan_caches = nullptr;
+
+// Usage of threads that already released their cache.
+std::atomic<int64_t> untracked_usage = { 0 };
+std::atomic<uint64_t> max_usage = { 0 };
+
+thread_local ThreadCache *thread_cache = nullptr;
+thread_local bool thread_cache_released = false;
+
+void _push_remote_frees(ThreadCache *p_owner, FreeBlock *p_head, FreeBlock *p_tail) {
+	FreeBlock *old_head = p_owner->remote_frees.load(std::memory_order_relaxed);
+	do {
+		p_tail->next = old_head;
+	} while (!p_owner->remote_frees.compare_exchange_weak(old_head, p_head, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void _flush_remote_batch(ThreadCache *p_cache) {
+	if (p_cache->remote_batch_count > 0) {
+		_push_remote_frees(p_cache->remote_batch_owner, p_cache->remote_batch_head, p_cache->remote_batch_tail);
+	}
+	p_cache->remote_batch_owner = nullptr;
+	p_cache->remote_batch_head = nullptr;
+	p_cache->remote_batch_tail = nullptr;
+	p_cache->remote_batch_count = 0;
+}
+
+_FORCE_INLINE_ BlockHeader *_get_header(void *p_memory) {
+	return reinterpret_cast<BlockHeader *>(static_cast<uint8_t *>(p_memory) - HEADER_SIZE);
+}
+
+struct ThreadCacheRelease {
+	bool active = false;
+
+	~ThreadCacheRelease() {
+		ThreadCache *cache = thread_cache;
+		thread_cache = nullptr;
+		thread_cache_released = true;
+		if (!cache) {
+			return;
+		}
+
+		_flush_remote_batch(cache);
+
+		// Keep the cache and its blocks for the next thread, other threads may still free into it.
+		caches_lock.lock();
+		cache->next_orphan = orphan_caches;
+		orphan_caches = cache;
+		caches_lock.unlock();
+	}
+};
+
+thread_local ThreadCacheRelease thread_cache_release;
+
+ThreadCache *_acquire_thread_cache() {
+	if (thread_cache_released) {
+		// Thread is shutting down, everything goes through malloc from here on.
+		return nullptr;
+	}
+
+	caches_lock.lock();
+	ThreadCache *cache = orphan_caches;
+	if (cache) {
+		orphan_caches = cache->next_orphan;
+		cache->next_orphan = nullptr;
+	}
+	caches_lock.unlock();
+
+	if (!cache) {
+		void *mem = ::malloc(sizeof(ThreadCache));
+		if (!mem) {
+			return nullptr;
+		}
+		cache = new (mem) ThreadCache;
+
+		caches_lock.lock();
+		cache->next = caches;
+		caches = cache;
+		caches_lock.unlock();
+	}
+
+	thread_cache = cache;
+	thread_cache_release.active = true;
+	return cache;
+}
+
+_FORCE_INLINE_ ThreadCache *_get_thread_cache() {
+	ThreadCache *cache = thread_cache;
+	if (likely(cache)) {
+		return cache;
+	}
+	return _acquire_thread_cache();
+}
+
+void _collect_remote_frees(ThreadCache *p_cache) {
+	if (p_cache->remote_frees.load(std::memory_order_relaxed) == nullptr) {
+		return;
+	}
+
+	FreeBlock *block = p_cache->remote_frees.exchange(nullptr, std::memory_order_acquire);
+	while (block) {
+		FreeBlock *next = block->next;
+		const uint32_t size_class = _get_header(block)->size_class;
+		block->next = p_cache->free_lists[size_class];
+		p_cache->free_lists[size_class] = block;
+		block = next;
+	}
+}
+
+void *_alloc_large(size_t p_bytes) {
+	BlockHeader *header = static_cast<BlockHeader *>(::malloc(HEADER_SIZE + p_bytes));
+	if (!header) {
+		return nullptr;
+	}
+	header->large_size = p_bytes;
+	header->size_class = LARGE_SIZE_CLASS;
+	return reinterpret_cast<uint8_t *>(header) + HEADER_SIZE;
+}
+
+void *_alloc_small_slow(ThreadCache *p_cache, uint32_t p_size_class) {
+	_collect_remote_frees(p_cache);
+
+	FreeBlock *block = p_cache->free_lists[p_size_class];
+	if (block) {
+		p_cache->free_lists[p_size_class] = block->next;
+		return block;
+	}
+
+	const size_t stride = HEADER_SIZE + size_classes.sizes[p_size_class];
+	if (p_cache->span_cursors[p_size_class] == nullptr || size_t(p_cache->span_ends[p_size_class] - p_cache->span_cursors[p_size_class]) < stride) {
+		// Spans are never given back, their blocks keep cycling through the free lists.
+		uint8_t *span = static_cast<uint8_t *>(::malloc(SPAN_SIZE));
+		if (!span) {
+			return nullptr;
+		}
+		p_cache->span_cursors[p_size_class] = span;
+		p_cache->span_ends[p_size_class] = span + SPAN_SIZE;
+	}
+
+	BlockHeader *header = reinterpret_cast<BlockHeader *>(p_cache->span_cursors[p_size_class]);
+	p_cache->span_cursors[p_size_class] += stride;
+	header->owner = p_cache;
+	header->size_class = p_size_class;
+	return reinterpret_cast<uint8_t *>(header) + HEADER_SIZE;
+}
+
+} // namespace
+
+void *ThreadCacheAllocator::alloc(size_t p_bytes) {
+	ThreadCache *cache = p_bytes <= MAX_SMALL_SIZE ? _get_thread_cache() : nullptr;
+	if (!cache) {
+		return _alloc_large(p_bytes);
+	}
+
+	const uint32_t size_class = size_classes.lookup[(p_bytes + 15) / 16];
+	FreeBlock *block = cache->free_lists[size_class];
+	if (likely(block)) {
+		cache->free_lists[size_class] = block->next;
+		return block;
+	}
+	return _alloc_small_slow(cache, size_class);
+}
+
+void *ThreadCacheAllocator::realloc(void *p_memory, size_t p_bytes) {
+	if (!p_memory) {
+		return alloc(p_bytes);
+	}
+	if (p_bytes == 0) {
+		free(p_memory);
+		return nullptr;
+	}
+
+	BlockHeader *header = _get_header(p_memory);
+	size_t capacity;
+	if (header->size_class == LARGE_SIZE_CLASS) {
+		if (p_bytes > MAX_SMALL_SIZE) {
+			BlockHeader *new_header = static_cast<BlockHeader *>(::realloc(header, HEADER_SIZE + p_bytes));
+			if (!new_header) {
+				return nullptr;
+			}
+			new_header->large_size = p_bytes;
+			return reinterpret_cast<uint8_t *>(new_header) + HEADER_SIZE;
+		}
+		capacity = header->large_size;
+	} else {
+		capacity = size_classes.sizes[header->size_class];
+		// Keep the block unless it would end up mostly empty.
+		if (p_bytes <= capacity && (p_bytes > capacity / 2 || header->size_class == 0)) {
+			return p_memory;
+		}
+	}
+
+	void *new_memory = alloc(p_bytes);
+	if (!new_memory) {
+		return nullptr;
+	}
+	memcpy(new_memory, p_memory, MIN(capacity, p_bytes));
+	free(p_memory);
+	return new_memory;
+}
+
+void ThreadCacheAllocator::free(void *p_memory) {
+	if (!p_memory) {
+		return;
+	}
+
+	BlockHeader *header = _get_header(p_memory);
+	if (header->size_class == LARGE_SIZE_CLASS) {
+		::free(header);
+		return;
+	}
+
+	FreeBlock *block = static_cast<FreeBlock *>(p_memory);
+	ThreadCache *owner = header->owner;
+	ThreadCache *cache = thread_cache;
+
+	if (likely(cache == owner)) {
+		block->next = cache->free_lists[header->size_class];
+		cache->free_lists[header->size_class] = block;
+		return;
+	}
+
+	if (!cache) {
+		_push_remote_frees(owner, block, block);
+		return;
+	}
+
+	if (cache->remote_batch_owner != owner) {
+		_flush_remote_batch(cache);
+		cache->remote_batch_owner = owner;
+		cache->remote_batch_tail = block;
+	}
+	block->next = cache->remote_batch_head;
+	cache->remote_batch_head = block;
+	cache->remote_batch_count++;
+
+	if (cache->remote_batch_count >= REMOTE_BATCH_SIZE) {
+		_flush_remote_batch(cache);
+	}
+}
+
+void ThreadCacheAllocator::add_usage(int64_t p_bytes) {
+	ThreadCache *cache = _get_thread_cache();
+	if (likely(cache)) {
+		// Single writer, a plain load and store is enough and keeps the cache line local.
+		cache->usage.store(cache->usage.load(std::memory_order_relaxed) + p_bytes, std::memory_order_relaxed);
+	} else {
+		untracked_usage.fetch_add(p_bytes, std::memory_order_relaxed);
+	}
+}
+
+uint64_t ThreadCacheAllocator::get_usage() {
+	int64_t total = untracked_usage.load(std::memory_order_relaxed);
+
+	caches_lock.lock();
+	for (const ThreadCache *cache = caches; cache; cache = cache->next) {
+		total += cache->usage.load(std::memory_order_relaxed);
+	}
+	caches_lock.unlock();
+
+	// Frees are counted by the thread doing them, so the total can briefly look negative.
+	const uint64_t usage = total > 0 ? uint64_t(total) : 0;
+
+	uint64_t current_max = max_usage.load(std::memory_order_relaxed);
+	while (usage > current_max && !max_usage.compare_exchange_weak(current_max, usage, std::memory_order_relaxed)) {
+		// Retry.
+	}
+	return usage;
+}
+
+uint64_t ThreadCacheAllocator::get_max_usage() {
+	get_usage();
+	return max_usage.load(std::memory_order_relaxed);
+}
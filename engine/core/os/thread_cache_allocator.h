@@ -0,0 +1,59 @@
+/**************************************************************************/
+/*  thread_cache_allocator.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+#ifndef THREAD_CACHE_ALLOCATOR_H
+#define THREAD_CACHE_ALLOCATOR_H
+
+#include "core/typedefs.h"
+
+#include <stddef.h>
+
+// Small object allocator with a free list cache per thread and per size class.
+// Memory::alloc_static uses it instead of malloc when built with thread_cache_allocator=yes.
+//
+// Allocations up to MAX_SMALL_SIZE bytes are carved from spans that are never returned to the system.
+// Larger allocations go straight to malloc. Blocks freed by a thread other than the one that allocated
+// them are batched and handed back to the owning thread cache, which picks them up once it runs out of
+// free blocks. When a thread exits its cache is kept around and adopted by the next thread that starts.
+class ThreadCacheAllocator {
+public:
+	static constexpr size_t MAX_SMALL_SIZE = 4096;
+
+	static void *alloc(size_t p_bytes);
+	static void *realloc(void *p_memory, size_t p_bytes);
+	static void free(void *p_memory);
+
+	// Usage is counted per thread and only added up when requested, so the peak is only
+	// as precise as the rate at which it is queried.
+	static void add_usage(int64_t p_bytes);
+	static uint64_t get_usage();
+	static uint64_t get_max_usage();
+};
+
+#endif // THREAD_CACHE_ALLOCATOR_H
@@ -310,6 +310,8 @@ void register_core_settings() {
 
 	GLOBAL_DEF("threading/worker_pool/max_threads", -1);
 	GLOBAL_DEF("threading/worker_pool/low_priority_thread_ratio", 0.3);
+
+	ResourceLoader::set_parallel_dependency_loading(GLOBAL_DEF("loading/resource_loader/parallel_dependency_loading", true));
 }
 
 void register_core_singletons() {
@@ -48,7 +48,16 @@ class StringName {
 	enum {
 		STRING_TABLE_BITS = 16,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		// Buckets are spread across shards, each guarded by its own lock, so that threads
+		// interning or releasing different names don't serialize on a single mutex.
+		STRING_TABLE_SHARD_BITS = 6,
+		STRING_TABLE_SHARD_COUNT = 1 << STRING_TABLE_SHARD_BITS,
+		STRING_TABLE_SHARD_MASK = STRING_TABLE_SHARD_COUNT - 1
+	};
+
+	struct alignas(64) TableShard {
+		Mutex mutex;
 	};
 
 	struct _Data {
@@ -76,6 +85,8 @@ class StringName {
 	friend void unregister_core_types();
 	friend class Main;
 	static Mutex mutex;
+	static TableShard table_shards[STRING_TABLE_SHARD_COUNT];
+	_FORCE_INLINE_ static Mutex &_get_table_mutex(uint32_t p_idx) { return table_shards[p_idx & STRING_TABLE_SHARD_MASK].mutex; }
 	static void setup();
 	static void cleanup();
 	static bool configured;
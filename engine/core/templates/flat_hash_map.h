@@ -0,0 +1,508 @@
+/**************************************************************************/
+/*  flat_hash_map.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLAT_HASH_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/**
+ * Control bytes shared by FlatHashMap and FlatHashSet.
+ *
+ * Every slot has a control byte that is either empty, deleted (a tombstone) or
+ * holds the low 7 bits of the slot's hash. Slots are probed in groups of 16, so
+ * a single SIMD compare finds all candidates of a group at once.
+ */
+struct FlatHashGroup {
+	static constexpr uint32_t WIDTH = 16;
+	static constexpr int8_t CTRL_EMPTY = -128;
+	static constexpr int8_t CTRL_DELETED = -2;
+
+	static _FORCE_INLINE_ int8_t get_h2(uint32_t p_hash) { return int8_t(p_hash & 0x7F); }
+	static _FORCE_INLINE_ uint32_t get_h1(uint32_t p_hash) { return p_hash >> 7; }
+
+	// Bitmasks with one bit per slot of the group starting at p_ctrl.
+#ifdef FLAT_HASH_USE_SSE2
+	static _FORCE_INLINE_ uint32_t match(const int8_t *p_ctrl, int8_t p_h2) {
+		__m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl));
+		return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(p_h2), ctrl)));
+	}
+	static _FORCE_INLINE_ uint32_t match_empty(const int8_t *p_ctrl) {
+		return match(p_ctrl, CTRL_EMPTY);
+	}
+	static _FORCE_INLINE_ uint32_t match_empty_or_deleted(const int8_t *p_ctrl) {
+		// Only empty and deleted slots have the sign bit set.
+		return uint32_t(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl))));
+	}
+#else
+	static _FORCE_INLINE_ uint32_t match(const int8_t *p_ctrl, int8_t p_h2) {
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < WIDTH; i++) {
+			mask |= uint32_t(p_ctrl[i] == p_h2) << i;
+		}
+		return mask;
+	}
+	static _FORCE_INLINE_ uint32_t match_empty(const int8_t *p_ctrl) {
+		return match(p_ctrl, CTRL_EMPTY);
+	}
+	static _FORCE_INLINE_ uint32_t match_empty_or_deleted(const int8_t *p_ctrl) {
+		uint32_t mask = 0;
+		for (uint32_t i = 0; i < WIDTH; i++) {
+			mask |= uint32_t(p_ctrl[i] < 0) << i;
+		}
+		return mask;
+	}
+#endif
+
+	static _FORCE_INLINE_ uint32_t first_bit(uint32_t p_mask) {
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward(&index, p_mask);
+		return index;
+#else
+		return __builtin_ctz(p_mask);
+#endif
+	}
+
+	static _FORCE_INLINE_ bool is_full(int8_t p_ctrl) { return p_ctrl >= 0; }
+
+	// Maximum amount of used slots (elements and tombstones) before growing, 7/8 of the capacity.
+	static _FORCE_INLINE_ uint32_t get_max_used(uint32_t p_capacity) { return p_capacity - p_capacity / 8; }
+
+	static _FORCE_INLINE_ uint32_t get_capacity_for(uint32_t p_elements) {
+		uint32_t capacity = WIDTH;
+		while (get_max_used(capacity) < p_elements) {
+			capacity <<= 1;
+		}
+		return capacity;
+	}
+
+	// Probes whole groups with triangular steps, which visits every group once as the group count is a power of two.
+	// Returns the first slot in the probe sequence that is empty or deleted. The table always has an empty slot.
+	static _FORCE_INLINE_ uint32_t find_insert_pos(const int8_t *p_ctrl, uint32_t p_capacity, uint32_t p_hash) {
+		const uint32_t group_mask = p_capacity / WIDTH - 1;
+		uint32_t group = get_h1(p_hash) & group_mask;
+		for (uint32_t step = 1;; step++) {
+			uint32_t mask = match_empty_or_deleted(p_ctrl + group * WIDTH);
+			if (mask) {
+				return group * WIDTH + first_bit(mask);
+			}
+			group = (group + step) & group_mask;
+		}
+	}
+
+	// A slot can go back to being empty only when its group still has an empty slot, as no probe sequence
+	// has gone past that group then. Otherwise it must become a tombstone. Returns true if it became empty.
+	static _FORCE_INLINE_ bool erase_pos(int8_t *p_ctrl, uint32_t p_pos) {
+		const uint32_t group_start = p_pos & ~(WIDTH - 1);
+		if (match_empty(p_ctrl + group_start)) {
+			p_ctrl[p_pos] = CTRL_EMPTY;
+			return true;
+		}
+		p_ctrl[p_pos] = CTRL_DELETED;
+		return false;
+	}
+
+	static int8_t *alloc_ctrl(uint32_t p_capacity) {
+		int8_t *ctrl = reinterpret_cast<int8_t *>(Memory::alloc_static(p_capacity));
+		memset(ctrl, CTRL_EMPTY, p_capacity);
+		return ctrl;
+	}
+};
+
+/**
+ * A Swiss table style HashMap. Keys and values are stored inline in a single
+ * slot array next to an array of control bytes, so inserting doesn't allocate
+ * per element and lookups only touch the control bytes of a group plus the
+ * slots whose hash bits match.
+ *
+ * Unlike HashMap, iteration order is unspecified and pointers to elements are
+ * invalidated when the map grows. Erasing while iterating is fine, as erasing
+ * never moves other elements.
+ */
+
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class FlatHashMap {
+	typedef KeyValue<TKey, TValue> Element;
+
+	int8_t *ctrl = nullptr;
+	KeyValue<TKey, TValue> *slots = nullptr;
+	uint32_t capacity = 0;
+	uint32_t num_elements = 0;
+	uint32_t growth_left = 0; // Insertions into empty slots left before growing.
+
+	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		if (num_elements == 0) {
+			return false;
+		}
+
+		const uint32_t hash = Hasher::hash(p_key);
+		const int8_t h2 = FlatHashGroup::get_h2(hash);
+		const uint32_t group_mask = capacity / FlatHashGroup::WIDTH - 1;
+		uint32_t group = FlatHashGroup::get_h1(hash) & group_mask;
+
+		for (uint32_t step = 1;; step++) {
+			const int8_t *group_ctrl = ctrl + group * FlatHashGroup::WIDTH;
+			uint32_t mask = FlatHashGroup::match(group_ctrl, h2);
+			while (mask) {
+				uint32_t pos = group * FlatHashGroup::WIDTH + FlatHashGroup::first_bit(mask);
+				if (Comparator::compare(slots[pos].key, p_key)) {
+					r_pos = pos;
+					return true;
+				}
+				mask &= mask - 1;
+			}
+			if (FlatHashGroup::match_empty(group_ctrl)) {
+				return false;
+			}
+			group = (group + step) & group_mask;
+		}
+	}
+
+	void _rehash(uint32_t p_new_capacity) {
+		int8_t *old_ctrl = ctrl;
+		KeyValue<TKey, TValue> *old_slots = slots;
+		uint32_t old_capacity = capacity;
+
+		capacity = p_new_capacity;
+		ctrl = FlatHashGroup::alloc_ctrl(capacity);
+		slots = reinterpret_cast<KeyValue<TKey, TValue> *>(Memory::alloc_static(sizeof(KeyValue<TKey, TValue>) * capacity));
+		growth_left = FlatHashGroup::get_max_used(capacity) - num_elements;
+
+		if (old_ctrl == nullptr) {
+			return;
+		}
+
+		for (uint32_t i = 0; i < old_capacity; i++) {
+			if (!FlatHashGroup::is_full(old_ctrl[i])) {
+				continue;
+			}
+			uint32_t hash = Hasher::hash(old_slots[i].key);
+			uint32_t pos = FlatHashGroup::find_insert_pos(ctrl, capacity, hash);
+			ctrl[pos] = FlatHashGroup::get_h2(hash);
+			memnew_placement(&slots[pos], Element(old_slots[i]));
+			old_slots[i].~KeyValue<TKey, TValue>();
+		}
+
+		Memory::free_static(old_ctrl);
+		Memory::free_static(old_slots);
+	}
+
+	uint32_t _insert(const TKey &p_key, const TValue &p_value) {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			slots[pos].value = p_value;
+			return pos;
+		}
+
+		if (unlikely(growth_left == 0)) {
+			// Tombstones use up growth too, rehash in place if they are the reason the table is full.
+			if (capacity && num_elements < FlatHashGroup::get_max_used(capacity) / 2) {
+				_rehash(capacity);
+			} else {
+				_rehash(capacity ? capacity * 2 : FlatHashGroup::WIDTH);
+			}
+		}
+
+		const uint32_t hash = Hasher::hash(p_key);
+		pos = FlatHashGroup::find_insert_pos(ctrl, capacity, hash);
+		if (ctrl[pos] == FlatHashGroup::CTRL_EMPTY) {
+			growth_left--;
+		}
+		ctrl[pos] = FlatHashGroup::get_h2(hash);
+		memnew_placement(&slots[pos], Element(p_key, p_value));
+		num_elements++;
+		return pos;
+	}
+
+	void _erase_pos(uint32_t p_pos) {
+		slots[p_pos].~KeyValue<TKey, TValue>();
+		if (FlatHashGroup::erase_pos(ctrl, p_pos)) {
+			growth_left++;
+		}
+		num_elements--;
+	}
+
+	_FORCE_INLINE_ uint32_t _next_full(uint32_t p_pos) const {
+		while (p_pos < capacity && !FlatHashGroup::is_full(ctrl[p_pos])) {
+			p_pos++;
+		}
+		return p_pos;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (ctrl == nullptr) {
+			return;
+		}
+		if (num_elements) {
+			for (uint32_t i = 0; i < capacity; i++) {
+				if (FlatHashGroup::is_full(ctrl[i])) {
+					slots[i].~KeyValue<TKey, TValue>();
+				}
+			}
+		}
+		memset(ctrl, FlatHashGroup::CTRL_EMPTY, capacity);
+		num_elements = 0;
+		growth_left = FlatHashGroup::get_max_used(capacity);
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "FlatHashMap key not found.");
+		return slots[pos].value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "FlatHashMap key not found.");
+		return slots[pos].value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &slots[pos].value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return &slots[pos].value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t _pos = 0;
+		return _lookup_pos(p_key, _pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return false;
+		}
+		_erase_pos(pos);
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_capacity = FlatHashGroup::get_capacity_for(p_new_capacity);
+		if (new_capacity > capacity) {
+			_rehash(new_capacity);
+		}
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return map->slots[pos];
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return &map->slots[pos]; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			pos = map->_next_full(pos + 1);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return pos == b.pos; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return pos != b.pos; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && pos < map->capacity;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const FlatHashMap *p_map, uint32_t p_pos) {
+			map = p_map;
+			pos = p_pos;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		friend class FlatHashMap;
+		const FlatHashMap *map = nullptr;
+		uint32_t pos = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return map->slots[pos];
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return &map->slots[pos]; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			pos = map->_next_full(pos + 1);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return pos == b.pos; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return pos != b.pos; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr && pos < map->capacity;
+		}
+
+		_FORCE_INLINE_ Iterator(FlatHashMap *p_map, uint32_t p_pos) {
+			map = p_map;
+			pos = p_pos;
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+		operator ConstIterator() const {
+			return ConstIterator(map, pos);
+		}
+
+	private:
+		friend class FlatHashMap;
+		FlatHashMap *map = nullptr;
+		uint32_t pos = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(this, num_elements ? _next_full(0) : capacity);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(this, capacity);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return Iterator(this, pos);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			_erase_pos(p_iter.pos);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(this, num_elements ? _next_full(0) : capacity);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(this, capacity);
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return ConstIterator(this, pos);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND(!exists);
+		return slots[pos].value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			pos = _insert(p_key, TValue());
+		}
+		return slots[pos].value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		return Iterator(this, _insert(p_key, p_value));
+	}
+
+	/* Constructors */
+
+	FlatHashMap(const FlatHashMap &p_other) {
+		reserve(p_other.num_elements);
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	void operator=(const FlatHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+		reserve(p_other.num_elements);
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	FlatHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	FlatHashMap() {}
+
+	~FlatHashMap() {
+		clear();
+		if (ctrl != nullptr) {
+			Memory::free_static(ctrl);
+			Memory::free_static(slots);
+		}
+	}
+};
+
+#endif // FLAT_HASH_MAP_H
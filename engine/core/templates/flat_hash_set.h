@@ -0,0 +1,299 @@
+/**************************************************************************/
+/*  flat_hash_set.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FLAT_HASH_SET_H
+#define FLAT_HASH_SET_H
+
+#include "core/templates/flat_hash_map.h"
+
+/**
+ * Set counterpart of FlatHashMap, see FlatHashGroup for the table layout.
+ * Iteration order is unspecified and erasing while iterating is fine.
+ */
+
+template <typename TKey,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class FlatHashSet {
+	int8_t *ctrl = nullptr;
+	TKey *keys = nullptr;
+	uint32_t capacity = 0;
+	uint32_t num_elements = 0;
+	uint32_t growth_left = 0; // Insertions into empty slots left before growing.
+
+	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		if (num_elements == 0) {
+			return false;
+		}
+
+		const uint32_t hash = Hasher::hash(p_key);
+		const int8_t h2 = FlatHashGroup::get_h2(hash);
+		const uint32_t group_mask = capacity / FlatHashGroup::WIDTH - 1;
+		uint32_t group = FlatHashGroup::get_h1(hash) & group_mask;
+
+		for (uint32_t step = 1;; step++) {
+			const int8_t *group_ctrl = ctrl + group * FlatHashGroup::WIDTH;
+			uint32_t mask = FlatHashGroup::match(group_ctrl, h2);
+			while (mask) {
+				uint32_t pos = group * FlatHashGroup::WIDTH + FlatHashGroup::first_bit(mask);
+				if (Comparator::compare(keys[pos], p_key)) {
+					r_pos = pos;
+					return true;
+				}
+				mask &= mask - 1;
+			}
+			if (FlatHashGroup::match_empty(group_ctrl)) {
+				return false;
+			}
+			group = (group + step) & group_mask;
+		}
+	}
+
+	void _rehash(uint32_t p_new_capacity) {
+		int8_t *old_ctrl = ctrl;
+		TKey *old_keys = keys;
+		uint32_t old_capacity = capacity;
+
+		capacity = p_new_capacity;
+		ctrl = FlatHashGroup::alloc_ctrl(capacity);
+		keys = reinterpret_cast<TKey *>(Memory::alloc_static(sizeof(TKey) * capacity));
+		growth_left = FlatHashGroup::get_max_used(capacity) - num_elements;
+
+		if (old_ctrl == nullptr) {
+			return;
+		}
+
+		for (uint32_t i = 0; i < old_capacity; i++) {
+			if (!FlatHashGroup::is_full(old_ctrl[i])) {
+				continue;
+			}
+			uint32_t hash = Hasher::hash(old_keys[i]);
+			uint32_t pos = FlatHashGroup::find_insert_pos(ctrl, capacity, hash);
+			ctrl[pos] = FlatHashGroup::get_h2(hash);
+			memnew_placement(&keys[pos], TKey(old_keys[i]));
+			old_keys[i].~TKey();
+		}
+
+		Memory::free_static(old_ctrl);
+		Memory::free_static(old_keys);
+	}
+
+	uint32_t _insert(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (_lookup_pos(p_key, pos)) {
+			return pos;
+		}
+
+		if (unlikely(growth_left == 0)) {
+			// Tombstones use up growth too, rehash in place if they are the reason the table is full.
+			if (capacity && num_elements < FlatHashGroup::get_max_used(capacity) / 2) {
+				_rehash(capacity);
+			} else {
+				_rehash(capacity ? capacity * 2 : FlatHashGroup::WIDTH);
+			}
+		}
+
+		const uint32_t hash = Hasher::hash(p_key);
+		pos = FlatHashGroup::find_insert_pos(ctrl, capacity, hash);
+		if (ctrl[pos] == FlatHashGroup::CTRL_EMPTY) {
+			growth_left--;
+		}
+		ctrl[pos] = FlatHashGroup::get_h2(hash);
+		memnew_placement(&keys[pos], TKey(p_key));
+		num_elements++;
+		return pos;
+	}
+
+	void _erase_pos(uint32_t p_pos) {
+		keys[p_pos].~TKey();
+		if (FlatHashGroup::erase_pos(ctrl, p_pos)) {
+			growth_left++;
+		}
+		num_elements--;
+	}
+
+	_FORCE_INLINE_ uint32_t _next_full(uint32_t p_pos) const {
+		while (p_pos < capacity && !FlatHashGroup::is_full(ctrl[p_pos])) {
+			p_pos++;
+		}
+		return p_pos;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (ctrl == nullptr) {
+			return;
+		}
+		if (num_elements) {
+			for (uint32_t i = 0; i < capacity; i++) {
+				if (FlatHashGroup::is_full(ctrl[i])) {
+					keys[i].~TKey();
+				}
+			}
+		}
+		memset(ctrl, FlatHashGroup::CTRL_EMPTY, capacity);
+		num_elements = 0;
+		growth_left = FlatHashGroup::get_max_used(capacity);
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t _pos = 0;
+		return _lookup_pos(p_key, _pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return false;
+		}
+		_erase_pos(pos);
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_capacity = FlatHashGroup::get_capacity_for(p_new_capacity);
+		if (new_capacity > capacity) {
+			_rehash(new_capacity);
+		}
+	}
+
+	/** Iterator API **/
+
+	struct Iterator {
+		_FORCE_INLINE_ const TKey &operator*() const {
+			return set->keys[pos];
+		}
+		_FORCE_INLINE_ const TKey *operator->() const {
+			return &set->keys[pos];
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			pos = set->_next_full(pos + 1);
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return pos == b.pos; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return pos != b.pos; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return set != nullptr && pos < set->capacity;
+		}
+
+		_FORCE_INLINE_ Iterator(const FlatHashSet *p_set, uint32_t p_pos) {
+			set = p_set;
+			pos = p_pos;
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+	private:
+		friend class FlatHashSet;
+		const FlatHashSet *set = nullptr;
+		uint32_t pos = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() const {
+		return Iterator(this, num_elements ? _next_full(0) : capacity);
+	}
+	_FORCE_INLINE_ Iterator end() const {
+		return Iterator(this, capacity);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		if (!_lookup_pos(p_key, pos)) {
+			return end();
+		}
+		return Iterator(this, pos);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			_erase_pos(p_iter.pos);
+		}
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key) {
+		return Iterator(this, _insert(p_key));
+	}
+
+	/* Constructors */
+
+	FlatHashSet(const FlatHashSet &p_other) {
+		reserve(p_other.num_elements);
+		for (const TKey &key : p_other) {
+			insert(key);
+		}
+	}
+
+	void operator=(const FlatHashSet &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+		reserve(p_other.num_elements);
+		for (const TKey &key : p_other) {
+			insert(key);
+		}
+	}
+
+	FlatHashSet(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	FlatHashSet() {}
+
+	void reset() {
+		clear();
+		if (ctrl != nullptr) {
+			Memory::free_static(ctrl);
+			Memory::free_static(keys);
+			ctrl = nullptr;
+			keys = nullptr;
+			capacity = 0;
+			growth_left = 0;
+		}
+	}
+
+	~FlatHashSet() {
+		reset();
+	}
+};
+
+#endif // FLAT_HASH_SET_H
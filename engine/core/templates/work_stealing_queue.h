@@ -0,0 +1,186 @@
+/**************************************************************************/
+/*  work_stealing_queue.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef WORK_STEALING_QUEUE_H
+#define WORK_STEALING_QUEUE_H
+
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+#include "core/typedefs.h"
+
+#include <atomic>
+#include <type_traits>
+
+// Chase-Lev work stealing deque, as described in "Correct and Efficient Work-Stealing
+// for Weak Memory Models" (Lê, Pop, Cohen, Zappa Nardelli, 2013).
+// - push() and pop() may only be called from the thread owning the queue, and work on the
+//   bottom end (LIFO).
+// - steal() may be called from any thread, and takes from the top end (FIFO).
+// Buffers replaced when growing are kept alive until the queue is destroyed, since a
+// concurrent steal() may still be reading from them.
+
+template <typename T>
+class WorkStealingQueue {
+	static_assert(std::is_trivially_copyable_v<T>);
+	static_assert(std::atomic<T>::is_always_lock_free);
+
+	struct Buffer {
+		int64_t mask = 0;
+		std::atomic<T> *data = nullptr;
+
+		_FORCE_INLINE_ T get(int64_t p_index) const {
+			return data[p_index & mask].load(std::memory_order_relaxed);
+		}
+		_FORCE_INLINE_ void put(int64_t p_index, T p_value) {
+			data[p_index & mask].store(p_value, std::memory_order_relaxed);
+		}
+	};
+
+	// Top and bottom are written by different threads, keep them in separate cache lines.
+	// Padding is used instead of alignas, since queues get placed in memory allocated by memalloc.
+	static const int CACHE_LINE_SIZE = 64;
+	std::atomic<int64_t> top = 0;
+	uint8_t top_padding[CACHE_LINE_SIZE - sizeof(std::atomic<int64_t>)];
+	std::atomic<int64_t> bottom = 0;
+	uint8_t bottom_padding[CACHE_LINE_SIZE - sizeof(std::atomic<int64_t>)];
+	std::atomic<Buffer *> buffer = nullptr;
+	LocalVector<Buffer *> retired_buffers;
+
+	static Buffer *_alloc_buffer(int64_t p_capacity) {
+		Buffer *new_buffer = memnew(Buffer);
+		new_buffer->mask = p_capacity - 1;
+		new_buffer->data = (std::atomic<T> *)memalloc(sizeof(std::atomic<T>) * p_capacity);
+		for (int64_t i = 0; i < p_capacity; i++) {
+			memnew_placement(&new_buffer->data[i], std::atomic<T>);
+		}
+		return new_buffer;
+	}
+
+	static void _free_buffer(Buffer *p_buffer) {
+		memfree(p_buffer->data);
+		memdelete(p_buffer);
+	}
+
+	Buffer *_grow(Buffer *p_buffer, int64_t p_bottom, int64_t p_top) {
+		Buffer *new_buffer = _alloc_buffer((p_buffer->mask + 1) * 2);
+		for (int64_t i = p_top; i < p_bottom; i++) {
+			new_buffer->put(i, p_buffer->get(i));
+		}
+		retired_buffers.push_back(p_buffer);
+		buffer.store(new_buffer, std::memory_order_release);
+		return new_buffer;
+	}
+
+public:
+	// Owner only.
+	void push(T p_value) {
+		const int64_t b = bottom.load(std::memory_order_relaxed);
+		const int64_t t = top.load(std::memory_order_acquire);
+		Buffer *a = buffer.load(std::memory_order_relaxed);
+		if (b - t > a->mask) {
+			a = _grow(a, b, t);
+		}
+		a->put(b, p_value);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+	}
+
+	// Owner only.
+	bool pop(T &r_value) {
+		const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+		Buffer *a = buffer.load(std::memory_order_relaxed);
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t t = top.load(std::memory_order_relaxed);
+
+		if (t > b) {
+			// Empty.
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		r_value = a->get(b);
+		if (t == b) {
+			// Last element, race against thieves for it.
+			const bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return won;
+		}
+		return true;
+	}
+
+	// Any thread. Returns false only if the queue was observed empty, a lost race against
+	// another thief or the owner is retried.
+	bool steal(T &r_value) {
+		while (true) {
+			int64_t t = top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64_t b = bottom.load(std::memory_order_acquire);
+			if (t >= b) {
+				return false;
+			}
+
+			Buffer *a = buffer.load(std::memory_order_acquire);
+			const T value = a->get(t);
+			if (top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+				r_value = value;
+				return true;
+			}
+		}
+	}
+
+	// Approximate when called from a thread that isn't the owner.
+	int64_t size() const {
+		const int64_t b = bottom.load(std::memory_order_relaxed);
+		const int64_t t = top.load(std::memory_order_relaxed);
+		return MAX(b - t, 0);
+	}
+
+	bool is_empty() const {
+		return size() == 0;
+	}
+
+	explicit WorkStealingQueue(int64_t p_initial_capacity = 256) {
+		int64_t capacity = 1;
+		while (capacity < p_initial_capacity) {
+			capacity <<= 1;
+		}
+		buffer.store(_alloc_buffer(capacity), std::memory_order_relaxed);
+	}
+
+	~WorkStealingQueue() {
+		_free_buffer(buffer.load(std::memory_order_relaxed));
+		for (Buffer *retired : retired_buffers) {
+			_free_buffer(retired);
+		}
+	}
+};
+
+#endif // WORK_STEALING_QUEUE_H
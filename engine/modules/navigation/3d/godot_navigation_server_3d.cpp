@@ -86,6 +86,7 @@ GodotNavigationServer3D::GodotNavigationServer3D() {}
 
 GodotNavigationServer3D::~GodotNavigationServer3D() {
 	flush_queries();
+	_clear_async_path_queries();
 }
 
 void GodotNavigationServer3D::add_command(SetCommand *command) {
@@ -1247,6 +1248,9 @@ void GodotNavigationServer3D::flush_queries() {
 	MutexLock lock(commands_mutex);
 	MutexLock lock2(operations_mutex);
 
+	// Commands may free maps that the async path queries are still reading.
+	_wait_for_async_path_queries();
+
 	for (SetCommand *command : commands) {
 		command->exec(this);
 		memdelete(command);
@@ -1279,9 +1283,13 @@ void GodotNavigationServer3D::sync() {
 }
 
 void GodotNavigationServer3D::process(real_t p_delta_time) {
+	_finish_async_path_queries();
 	flush_queries();
 
 	if (!active) {
+		// Maps are not updated while inactive, but queries are still answered with their last state,
+		// like query_path() does. Otherwise anything waiting on them would wait forever.
+		_dispatch_async_path_queries();
 		return;
 	}
 
@@ -1327,6 +1335,8 @@ void GodotNavigationServer3D::process(real_t p_delta_time) {
 	pm_edge_merge_count = _new_pm_edge_merge_count;
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
+
+	_dispatch_async_path_queries();
 }
 
 void GodotNavigationServer3D::init() {
@@ -1337,6 +1347,7 @@ void GodotNavigationServer3D::init() {
 
 void GodotNavigationServer3D::finish() {
 	flush_queries();
+	_clear_async_path_queries();
 #ifndef _3D_DISABLED
 	if (navmesh_generator_3d) {
 		navmesh_generator_3d->finish();
@@ -1347,17 +1358,108 @@ void GodotNavigationServer3D::finish() {
 }
 
 PathQueryResult GodotNavigationServer3D::_query_path(const PathQueryParameters &p_parameters) const {
-	PathQueryResult r_query_result;
-
 	const NavMap *map = map_owner.get_or_null(p_parameters.map);
-	ERR_FAIL_NULL_V(map, r_query_result);
+	ERR_FAIL_NULL_V(map, PathQueryResult());
+
+	return _query_path_on_map(map, p_parameters);
+}
+
+void GodotNavigationServer3D::query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_COND(!p_query_parameters.is_valid());
+	ERR_FAIL_COND(!p_query_result.is_valid());
+
+	AsyncPathQuery *query = memnew(AsyncPathQuery);
+	query->parameters = p_query_parameters->get_parameters();
+	query->query_result = p_query_result;
+	query->callback = p_callback;
+
+	MutexLock lock(async_path_queries_mutex);
+	async_path_queries_queued.push_back(query);
+}
+
+void GodotNavigationServer3D::_process_async_path_query(uint32_t p_index, AsyncPathQuery **p_queries) {
+	AsyncPathQuery *query = p_queries[p_index];
+	if (query->map == nullptr) {
+		return;
+	}
+	query->result = _query_path_on_map(query->map, query->parameters);
+}
+
+void GodotNavigationServer3D::_dispatch_async_path_queries() {
+	MutexLock lock(async_path_queries_mutex);
+	ERR_FAIL_COND(async_path_queries_group_task != WorkerThreadPool::INVALID_TASK_ID);
+
+	for (AsyncPathQuery *query : async_path_queries_queued) {
+		// Resolved here so the worker threads never touch the map owner.
+		query->map = map_owner.get_or_null(query->parameters.map);
+		if (query->map == nullptr) {
+			// Still delivered with an empty result so the callback is called.
+			ERR_PRINT("Async path query map is invalid.");
+		}
+		async_path_queries_running.push_back(query);
+	}
+	async_path_queries_queued.clear();
+
+	if (async_path_queries_running.size() > 0) {
+		async_path_queries_group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotNavigationServer3D::_process_async_path_query, async_path_queries_running.ptr(), async_path_queries_running.size(), -1, false, SNAME("NavigationAsyncPathQueries"));
+	}
+}
+
+void GodotNavigationServer3D::_wait_for_async_path_queries() {
+	MutexLock lock(async_path_queries_mutex);
+	if (async_path_queries_group_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(async_path_queries_group_task);
+		async_path_queries_group_task = WorkerThreadPool::INVALID_TASK_ID;
+	}
+}
+
+void GodotNavigationServer3D::_finish_async_path_queries() {
+	_wait_for_async_path_queries();
+
+	LocalVector<AsyncPathQuery *> finished_queries;
+	{
+		MutexLock lock(async_path_queries_mutex);
+		finished_queries = async_path_queries_running;
+		async_path_queries_running.clear();
+	}
+
+	// Callbacks are called without holding any lock, they are free to queue new queries.
+	for (AsyncPathQuery *query : finished_queries) {
+		query->query_result->set_path(query->result.path);
+		query->query_result->set_path_types(query->result.path_types);
+		query->query_result->set_path_rids(query->result.path_rids);
+		query->query_result->set_path_owner_ids(query->result.path_owner_ids);
+
+		if (query->callback.is_valid()) {
+			query->callback.call();
+		}
+		memdelete(query);
+	}
+}
+
+void GodotNavigationServer3D::_clear_async_path_queries() {
+	_wait_for_async_path_queries();
+
+	MutexLock lock(async_path_queries_mutex);
+	for (AsyncPathQuery *query : async_path_queries_running) {
+		memdelete(query);
+	}
+	async_path_queries_running.clear();
+	for (AsyncPathQuery *query : async_path_queries_queued) {
+		memdelete(query);
+	}
+	async_path_queries_queued.clear();
+}
+
+PathQueryResult GodotNavigationServer3D::_query_path_on_map(const NavMap *p_map, const PathQueryParameters &p_parameters) const {
+	PathQueryResult r_query_result;
 
 	// run the pathfinding
 
 	if (p_parameters.pathfinding_algorithm == PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR) {
 		// while postprocessing is still part of map.get_path() need to check and route it here for the correct "optimize" post-processing
 		if (p_parameters.path_postprocessing == PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL) {
-			r_query_result.path = map->get_path(
+			r_query_result.path = p_map->get_path(
 					p_parameters.start_position,
 					p_parameters.target_position,
 					true,
@@ -1366,7 +1468,7 @@ PathQueryResult GodotNavigationServer3D::_query_path(const PathQueryParameters &
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_RIDS) ? &r_query_result.path_rids : nullptr,
 					p_parameters.metadata_flags.has_flag(PathMetadataFlags::PATH_INCLUDE_OWNERS) ? &r_query_result.path_owner_ids : nullptr);
 		} else if (p_parameters.path_postprocessing == PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED) {
-			r_query_result.path = map->get_path(
+			r_query_result.path = p_map->get_path(
 					p_parameters.start_position,
 					p_parameters.target_position,
 					false,
@@ -37,6 +37,7 @@
 #include "../nav_obstacle.h"
 #include "../nav_region.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
 #include "core/templates/rid_owner.h"
@@ -72,6 +73,21 @@ class GodotNavigationServer3D : public NavigationServer3D {
 
 	LocalVector<SetCommand *> commands;
 
+	struct AsyncPathQuery {
+		NavMap *map = nullptr;
+		NavigationUtilities::PathQueryParameters parameters;
+		NavigationUtilities::PathQueryResult result;
+		Ref<NavigationPathQueryResult3D> query_result;
+		Callable callback;
+	};
+
+	/// Async path queries can be queued from any thread. They are dispatched once the maps
+	/// are synced and their results are delivered at the start of the next process step.
+	Mutex async_path_queries_mutex;
+	LocalVector<AsyncPathQuery *> async_path_queries_queued;
+	LocalVector<AsyncPathQuery *> async_path_queries_running;
+	WorkerThreadPool::GroupID async_path_queries_group_task = WorkerThreadPool::INVALID_TASK_ID;
+
 	mutable RID_Owner<NavLink> link_owner;
 	mutable RID_Owner<NavMap> map_owner;
 	mutable RID_Owner<NavRegion> region_owner;
@@ -282,10 +298,19 @@ public:
 	virtual void finish() override;
 
 	virtual NavigationUtilities::PathQueryResult _query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const override;
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override;
 
 	int get_process_info(ProcessInfo p_info) const override;
 
 private:
+	NavigationUtilities::PathQueryResult _query_path_on_map(const NavMap *p_map, const NavigationUtilities::PathQueryParameters &p_parameters) const;
+
+	void _process_async_path_query(uint32_t p_index, AsyncPathQuery **p_queries);
+	void _dispatch_async_path_queries();
+	void _wait_for_async_path_queries();
+	void _finish_async_path_queries();
+	void _clear_async_path_queries();
+
 	void internal_free_agent(RID p_object);
 	void internal_free_obstacle(RID p_object);
 };
@@ -37,6 +37,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
+#include "core/templates/sort_array.h"
 
 #include <Obstacle2d.h>
 
@@ -63,6 +64,133 @@
 #define NAVMAP_ITERATION_ZERO_ERROR_MSG()
 #endif // DEBUG_ENABLED
 
+#define NAVMAP_BVH_LEAF_SIZE 4
+#define NAVMAP_BVH_MAX_DEPTH 64
+#define NAVMAP_CLUSTER_MAX_POLYGONS 64
+
+struct NavigationPolyCostCompare {
+	const LocalVector<gd::NavigationPoly> *navigation_polys = nullptr;
+	_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+		return (*navigation_polys)[p_a].total_cost < (*navigation_polys)[p_b].total_cost;
+	}
+};
+
+struct NavigationPolyHeapIndexer {
+	LocalVector<gd::NavigationPoly> *navigation_polys = nullptr;
+	_FORCE_INLINE_ void operator()(uint32_t p_value, uint32_t p_index) {
+		(*navigation_polys)[p_value].heap_index = p_index;
+	}
+};
+
+struct ClusterQueueEntry {
+	real_t cost = 0.0;
+	uint32_t cluster = 0;
+};
+
+struct ClusterQueueEntryCompare {
+	_FORCE_INLINE_ bool operator()(const ClusterQueueEntry &p_a, const ClusterQueueEntry &p_b) const {
+		return p_a.cost < p_b.cost;
+	}
+};
+
+// Memory reused by all the path queries made from the same thread.
+// Per element stamps avoid clearing the lookup tables between queries.
+struct NavMapPathQueryScratch {
+	LocalVector<gd::NavigationPoly> navigation_polys;
+	gd::Heap<uint32_t, NavigationPolyCostCompare, NavigationPolyHeapIndexer> to_visit;
+
+	// Index in navigation_polys of each map polygon, by gd::Polygon::id.
+	LocalVector<uint32_t> poly_navigation_index;
+	LocalVector<uint32_t> poly_stamps;
+
+	LocalVector<real_t> cluster_costs;
+	LocalVector<uint32_t> cluster_parents;
+	LocalVector<uint32_t> cluster_visited_stamps;
+	LocalVector<uint32_t> cluster_closed_stamps;
+	LocalVector<uint32_t> cluster_allowed_stamps;
+	gd::Heap<ClusterQueueEntry, ClusterQueueEntryCompare> cluster_to_visit;
+
+	uint32_t stamp = 0;
+
+	static void _grow_stamps(LocalVector<uint32_t> &r_stamps, uint32_t p_size) {
+		uint32_t old_size = r_stamps.size();
+		if (old_size < p_size) {
+			r_stamps.resize(p_size);
+			for (uint32_t i = old_size; i < p_size; i++) {
+				r_stamps[i] = 0;
+			}
+		}
+	}
+
+	void next_stamp() {
+		stamp++;
+		if (unlikely(stamp == 0)) {
+			// Wrapped around, stale stamps could now match.
+			for (uint32_t &poly_stamp : poly_stamps) {
+				poly_stamp = 0;
+			}
+			for (uint32_t i = 0; i < cluster_visited_stamps.size(); i++) {
+				cluster_visited_stamps[i] = 0;
+				cluster_closed_stamps[i] = 0;
+				cluster_allowed_stamps[i] = 0;
+			}
+			stamp = 1;
+		}
+	}
+
+	void begin_query(uint32_t p_polygon_count, uint32_t p_cluster_count) {
+		to_visit.less_than.navigation_polys = &navigation_polys;
+		to_visit.indexer.navigation_polys = &navigation_polys;
+		to_visit.clear();
+		navigation_polys.clear();
+
+		if (poly_navigation_index.size() < p_polygon_count) {
+			poly_navigation_index.resize(p_polygon_count);
+		}
+		_grow_stamps(poly_stamps, p_polygon_count);
+
+		if (cluster_costs.size() < p_cluster_count) {
+			cluster_costs.resize(p_cluster_count);
+			cluster_parents.resize(p_cluster_count);
+		}
+		_grow_stamps(cluster_visited_stamps, p_cluster_count);
+		_grow_stamps(cluster_closed_stamps, p_cluster_count);
+		_grow_stamps(cluster_allowed_stamps, p_cluster_count);
+
+		next_stamp();
+	}
+
+	_FORCE_INLINE_ int64_t get_navigation_poly_index(const gd::Polygon *p_poly) const {
+		return poly_stamps[p_poly->id] == stamp ? int64_t(poly_navigation_index[p_poly->id]) : -1;
+	}
+
+	_FORCE_INLINE_ void set_navigation_poly_index(const gd::Polygon *p_poly, uint32_t p_index) {
+		poly_stamps[p_poly->id] = stamp;
+		poly_navigation_index[p_poly->id] = p_index;
+	}
+
+	_FORCE_INLINE_ bool is_cluster_allowed(uint32_t p_cluster) const {
+		return p_cluster != UINT32_MAX && cluster_allowed_stamps[p_cluster] == stamp;
+	}
+
+	// Restarts the polygon search from the first navigation poly. This also drops the cluster corridor.
+	void reset_search() {
+		gd::NavigationPoly begin_navigation_poly = navigation_polys[0];
+		to_visit.clear();
+		navigation_polys.clear();
+		navigation_polys.push_back(begin_navigation_poly);
+
+		next_stamp();
+		set_navigation_poly_index(begin_navigation_poly.poly, 0);
+	}
+};
+
+static thread_local NavMapPathQueryScratch path_query_scratch;
+
+static _FORCE_INLINE_ real_t _get_aabb_distance_squared(const AABB &p_aabb, const Vector3 &p_point) {
+	return p_point.clamp(p_aabb.position, p_aabb.position + p_aabb.size).distance_squared_to(p_point);
+}
+
 void NavMap::set_up(Vector3 p_up) {
 	if (up == p_up) {
 		return;
@@ -154,40 +282,11 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	}
 
 	// Find the start poly and the end poly on this map.
-	const gd::Polygon *begin_poly = nullptr;
-	const gd::Polygon *end_poly = nullptr;
 	Vector3 begin_point;
 	Vector3 end_point;
-	real_t begin_d = FLT_MAX;
+	const gd::Polygon *begin_poly = _get_closest_polygon(p_origin, true, p_navigation_layers, begin_point);
+	const gd::Polygon *end_poly = _get_closest_polygon(p_destination, true, p_navigation_layers, end_point);
 	real_t end_d = FLT_MAX;
-	// Find the initial poly and the end poly on this map.
-	for (const gd::Polygon &p : polygons) {
-		// Only consider the polygon if it in a region with compatible layers.
-		if ((p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
-			continue;
-		}
-
-		// For each face check the distance between the origin/destination
-		for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
-			const Face3 face(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-
-			Vector3 point = face.get_closest_point_to(p_origin);
-			real_t distance_to_point = point.distance_to(p_origin);
-			if (distance_to_point < begin_d) {
-				begin_d = distance_to_point;
-				begin_poly = &p;
-				begin_point = point;
-			}
-
-			point = face.get_closest_point_to(p_destination);
-			distance_to_point = point.distance_to(p_destination);
-			if (distance_to_point < end_d) {
-				end_d = distance_to_point;
-				end_poly = &p;
-				end_point = point;
-			}
-		}
-	}
 
 	// Check for trivial cases
 	if (!begin_poly || !end_poly) {
@@ -219,9 +318,15 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 		return path;
 	}
 
+	NavMapPathQueryScratch &scratch = path_query_scratch;
+	scratch.begin_query(polygons.size() + link_polygons.size(), clusters.size());
+
+	// Long queries are first restricted to a corridor of clusters, if the end polygon turns out
+	// not to be reachable through it the search falls back to the whole map.
+	bool use_cluster_corridor = use_hierarchical_pathfinding && begin_point.distance_to(end_point) >= hierarchical_pathfinding_min_distance && _find_cluster_corridor(begin_poly, end_poly, p_navigation_layers, scratch);
+
 	// List of all reachable navigation polys.
-	LocalVector<gd::NavigationPoly> navigation_polys;
-	navigation_polys.reserve(polygons.size() * 0.75);
+	LocalVector<gd::NavigationPoly> &navigation_polys = scratch.navigation_polys;
 
 	// Add the start polygon to the reachable navigation polygons.
 	gd::NavigationPoly begin_navigation_poly = gd::NavigationPoly(begin_poly);
@@ -230,10 +335,10 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 	begin_navigation_poly.back_navigation_edge_pathway_start = begin_point;
 	begin_navigation_poly.back_navigation_edge_pathway_end = begin_point;
 	navigation_polys.push_back(begin_navigation_poly);
+	scratch.set_navigation_poly_index(begin_poly, 0);
 
-	// List of polygon IDs to visit.
-	List<uint32_t> to_visit;
-	to_visit.push_back(0);
+	// Polygons to visit, ordered by their total cost. The start polygon is expanded first.
+	gd::Heap<uint32_t, NavigationPolyCostCompare, NavigationPolyHeapIndexer> &to_visit = scratch.to_visit;
 
 	// This is an implementation of the A* algorithm.
 	int least_cost_id = 0;
@@ -256,6 +361,10 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 					continue;
 				}
 
+				if (use_cluster_corridor && !scratch.is_cluster_allowed(connection.polygon->cluster_id)) {
+					continue;
+				}
+
 				const gd::NavigationPoly &least_cost_poly = navigation_polys[least_cost_id];
 				real_t poly_enter_cost = 0.0;
 				real_t poly_travel_cost = least_cost_poly.poly->owner->get_travel_cost();
@@ -269,7 +378,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 				const Vector3 new_entry = Geometry3D::get_closest_point_to_segment(least_cost_poly.entry, pathway);
 				const real_t new_distance = (least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost) + poly_enter_cost + least_cost_poly.traveled_distance;
 
-				int64_t already_visited_polygon_index = navigation_polys.find(gd::NavigationPoly(connection.polygon));
+				int64_t already_visited_polygon_index = scratch.get_navigation_poly_index(connection.polygon);
 
 				if (already_visited_polygon_index != -1) {
 					// Polygon already visited, check if we can reduce the travel cost.
@@ -281,6 +390,11 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 						avp.back_navigation_edge_pathway_end = connection.pathway_end;
 						avp.traveled_distance = new_distance;
 						avp.entry = new_entry;
+						if (avp.heap_index != UINT32_MAX) {
+							// Still waiting to be visited, move it up the open set.
+							avp.total_cost = new_distance + avp.entry.distance_to(end_point) * avp.poly->owner->get_travel_cost();
+							to_visit.shift(avp.heap_index);
+						}
 					}
 				} else {
 					// Add the neighbor polygon to the reachable ones.
@@ -291,20 +405,30 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 					new_navigation_poly.back_navigation_edge_pathway_start = connection.pathway_start;
 					new_navigation_poly.back_navigation_edge_pathway_end = connection.pathway_end;
 					new_navigation_poly.traveled_distance = new_distance;
+					new_navigation_poly.total_cost = new_distance + new_entry.distance_to(end_point) * connection.polygon->owner->get_travel_cost();
 					new_navigation_poly.entry = new_entry;
 					navigation_polys.push_back(new_navigation_poly);
+					scratch.set_navigation_poly_index(connection.polygon, new_navigation_poly.self_id);
 
 					// Add the neighbor polygon to the polygons to visit.
-					to_visit.push_back(navigation_polys.size() - 1);
+					to_visit.push(new_navigation_poly.self_id);
 				}
 			}
 		}
 
-		// Removes the least cost polygon from the list of polygons to visit so we can advance.
-		to_visit.erase(least_cost_id);
-
 		// When the list of polygons to visit is empty at this point it means the End Polygon is not reachable
-		if (to_visit.size() == 0) {
+		if (to_visit.is_empty()) {
+			if (use_cluster_corridor) {
+				// Not reachable through the cluster corridor, search the whole map before giving up.
+				use_cluster_corridor = false;
+				scratch.reset_search();
+				least_cost_id = 0;
+				prev_least_cost_id = -1;
+				reachable_end = nullptr;
+				reachable_d = FLT_MAX;
+				continue;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -367,11 +491,7 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 			}
 
 			// Reset open and navigation_polys
-			gd::NavigationPoly np = navigation_polys[0];
-			navigation_polys.clear();
-			navigation_polys.push_back(np);
-			to_visit.clear();
-			to_visit.push_back(0);
+			scratch.reset_search();
 			least_cost_id = 0;
 			prev_least_cost_id = -1;
 
@@ -380,20 +500,8 @@ Vector<Vector3> NavMap::get_path(Vector3 p_origin, Vector3 p_destination, bool p
 			continue;
 		}
 
-		// Find the polygon with the minimum cost from the list of polygons to visit.
-		least_cost_id = -1;
-		real_t least_cost = FLT_MAX;
-		for (List<uint32_t>::Element *element = to_visit.front(); element != nullptr; element = element->next()) {
-			gd::NavigationPoly *np = &navigation_polys[element->get()];
-			real_t cost = np->traveled_distance;
-			cost += (np->entry.distance_to(end_point) * np->poly->owner->get_travel_cost());
-			if (cost < least_cost) {
-				least_cost_id = np->self_id;
-				least_cost = cost;
-			}
-		}
-
-		ERR_BREAK(least_cost_id == -1);
+		// Take the polygon with the minimum cost from the list of polygons to visit.
+		least_cost_id = to_visit.pop();
 
 		// Stores the further reachable end polygon, in case our goal is not reachable.
 		if (is_reachable) {
@@ -687,24 +795,266 @@ gd::ClosestPointQueryResult NavMap::get_closest_point_info(const Vector3 &p_poin
 	RWLockRead read_lock(map_rwlock);
 
 	gd::ClosestPointQueryResult result;
+	const gd::Polygon *closest_polygon = _get_closest_polygon(p_point, false, 0, result.point, &result.normal);
+	if (closest_polygon) {
+		result.owner = closest_polygon->owner->get_self();
+	}
+
+	return result;
+}
+
+const gd::Polygon *NavMap::_get_closest_polygon(const Vector3 &p_point, bool p_use_navigation_layers, uint32_t p_navigation_layers, Vector3 &r_closest_point, Vector3 *r_normal) const {
+	const gd::Polygon *closest_polygon = nullptr;
 	real_t closest_point_ds = FLT_MAX;
 
-	for (const gd::Polygon &p : polygons) {
-		// For each face check the distance to the point
-		for (size_t point_id = 2; point_id < p.points.size(); point_id += 1) {
-			const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
-			const Vector3 inters = f.get_closest_point_to(p_point);
-			const real_t ds = inters.distance_squared_to(p_point);
-			if (ds < closest_point_ds) {
-				result.point = inters;
-				result.normal = f.get_plane().normal;
-				result.owner = p.owner->get_self();
-				closest_point_ds = ds;
+	if (polygon_bvh.is_empty()) {
+		return nullptr;
+	}
+
+	uint32_t stack[NAVMAP_BVH_MAX_DEPTH];
+	uint32_t stack_size = 0;
+	stack[stack_size++] = 0;
+
+	while (stack_size > 0) {
+		const uint32_t node_index = stack[--stack_size];
+		const PolygonBVHNode &node = polygon_bvh[node_index];
+
+		if (_get_aabb_distance_squared(node.aabb, p_point) > closest_point_ds) {
+			continue;
+		}
+
+		if (node.count == 0) {
+			ERR_FAIL_COND_V(stack_size + 2 > NAVMAP_BVH_MAX_DEPTH, closest_polygon);
+			stack[stack_size++] = node.first_or_right;
+			stack[stack_size++] = node_index + 1;
+			continue;
+		}
+
+		for (uint32_t i = node.first_or_right; i < node.first_or_right + node.count; i++) {
+			const uint32_t polygon_index = polygon_bvh_indices[i];
+			const gd::Polygon &p = polygons[polygon_index];
+
+			// Only consider the polygon if it in a region with compatible layers.
+			if (p_use_navigation_layers && (p_navigation_layers & p.owner->get_navigation_layers()) == 0) {
+				continue;
+			}
+			if (_get_aabb_distance_squared(polygon_aabbs[polygon_index], p_point) > closest_point_ds) {
+				continue;
+			}
+
+			// For each face check the distance to the point.
+			for (size_t point_id = 2; point_id < p.points.size(); point_id++) {
+				const Face3 f(p.points[0].pos, p.points[point_id - 1].pos, p.points[point_id].pos);
+				const Vector3 inters = f.get_closest_point_to(p_point);
+				const real_t ds = inters.distance_squared_to(p_point);
+				// On ties keep the polygon that comes first in the map, same as a linear scan would.
+				if (ds < closest_point_ds || (ds == closest_point_ds && closest_polygon && p.id < closest_polygon->id)) {
+					closest_point_ds = ds;
+					closest_polygon = &p;
+					r_closest_point = inters;
+					if (r_normal) {
+						*r_normal = f.get_plane().normal;
+					}
+				}
 			}
 		}
 	}
 
-	return result;
+	return closest_polygon;
+}
+
+struct NavMapPolygonCenterCompare {
+	const LocalVector<gd::Polygon> *polygons = nullptr;
+	int axis = 0;
+	_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+		return (*polygons)[p_a].center[axis] < (*polygons)[p_b].center[axis];
+	}
+};
+
+uint32_t NavMap::_build_polygon_bvh_node(uint32_t p_first, uint32_t p_count) {
+	const uint32_t node_index = polygon_bvh.size();
+	polygon_bvh.push_back(PolygonBVHNode());
+
+	AABB aabb = polygon_aabbs[polygon_bvh_indices[p_first]];
+	for (uint32_t i = p_first + 1; i < p_first + p_count; i++) {
+		aabb.merge_with(polygon_aabbs[polygon_bvh_indices[i]]);
+	}
+	polygon_bvh[node_index].aabb = aabb;
+
+	if (p_count <= NAVMAP_BVH_LEAF_SIZE) {
+		polygon_bvh[node_index].first_or_right = p_first;
+		polygon_bvh[node_index].count = p_count;
+		return node_index;
+	}
+
+	// Median split along the longest axis, the first child always directly follows its parent.
+	SortArray<uint32_t, NavMapPolygonCenterCompare> sorter;
+	sorter.compare.polygons = &polygons;
+	sorter.compare.axis = aabb.get_longest_axis_index();
+	sorter.sort(polygon_bvh_indices.ptr() + p_first, p_count);
+
+	const uint32_t half = p_count / 2;
+	_build_polygon_bvh_node(p_first, half);
+	const uint32_t right_index = _build_polygon_bvh_node(p_first + half, p_count - half);
+	polygon_bvh[node_index].first_or_right = right_index;
+	return node_index;
+}
+
+void NavMap::_update_polygon_bvh() {
+	polygon_bvh.clear();
+	polygon_bvh_indices.resize(polygons.size());
+	polygon_aabbs.resize(polygons.size());
+
+	if (polygons.is_empty()) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < polygons.size(); i++) {
+		const gd::Polygon &p = polygons[i];
+		AABB aabb = AABB(p.points.is_empty() ? p.center : p.points[0].pos, Vector3());
+		for (const gd::Point &point : p.points) {
+			aabb.expand_to(point.pos);
+		}
+		polygon_aabbs[i] = aabb;
+		polygon_bvh_indices[i] = i;
+	}
+
+	polygon_bvh.reserve(polygons.size() * 2 / NAVMAP_BVH_LEAF_SIZE + 1);
+	_build_polygon_bvh_node(0, polygons.size());
+}
+
+void NavMap::_update_clusters(uint32_t p_link_polygon_count) {
+	clusters.clear();
+
+	LocalVector<gd::Polygon *> cluster_polygons;
+	cluster_polygons.reserve(polygons.size() + p_link_polygon_count);
+	for (gd::Polygon &p : polygons) {
+		p.cluster_id = UINT32_MAX;
+		cluster_polygons.push_back(&p);
+	}
+	for (uint32_t i = 0; i < p_link_polygon_count; i++) {
+		link_polygons[i].cluster_id = UINT32_MAX;
+		cluster_polygons.push_back(&link_polygons[i]);
+	}
+
+	// Grow clusters breadth first from every unassigned polygon, so that each one is connected.
+	LocalVector<gd::Polygon *> queue;
+	queue.reserve(NAVMAP_CLUSTER_MAX_POLYGONS);
+	for (gd::Polygon *seed : cluster_polygons) {
+		if (seed->cluster_id != UINT32_MAX) {
+			continue;
+		}
+
+		const uint32_t cluster_id = clusters.size();
+		clusters.push_back(PolygonCluster());
+
+		queue.clear();
+		queue.push_back(seed);
+		seed->cluster_id = cluster_id;
+
+		Vector3 center;
+		for (uint32_t i = 0; i < queue.size(); i++) {
+			const gd::Polygon *p = queue[i];
+			center += p->center;
+
+			for (const gd::Edge &edge : p->edges) {
+				for (const gd::Edge::Connection &connection : edge.connections) {
+					if (queue.size() >= NAVMAP_CLUSTER_MAX_POLYGONS) {
+						break;
+					}
+					if (connection.polygon->cluster_id == UINT32_MAX) {
+						connection.polygon->cluster_id = cluster_id;
+						queue.push_back(connection.polygon);
+					}
+				}
+			}
+		}
+		clusters[cluster_id].center = center / real_t(queue.size());
+	}
+
+	// Connect the clusters through the polygon connections crossing them.
+	for (const gd::Polygon *p : cluster_polygons) {
+		PolygonCluster &cluster = clusters[p->cluster_id];
+		for (const gd::Edge &edge : p->edges) {
+			for (const gd::Edge::Connection &connection : edge.connections) {
+				const uint32_t neighbor_id = connection.polygon->cluster_id;
+				if (neighbor_id == p->cluster_id) {
+					continue;
+				}
+				int64_t neighbor_index = cluster.neighbors.find(neighbor_id);
+				if (neighbor_index == -1) {
+					neighbor_index = cluster.neighbors.size();
+					cluster.neighbors.push_back(neighbor_id);
+					cluster.neighbor_navigation_layers.push_back(0);
+				}
+				cluster.neighbor_navigation_layers[neighbor_index] |= connection.polygon->owner->get_navigation_layers();
+			}
+		}
+	}
+}
+
+bool NavMap::_find_cluster_corridor(const gd::Polygon *p_begin_poly, const gd::Polygon *p_end_poly, uint32_t p_navigation_layers, NavMapPathQueryScratch &r_scratch) const {
+	const uint32_t begin_cluster = p_begin_poly->cluster_id;
+	const uint32_t end_cluster = p_end_poly->cluster_id;
+	if (begin_cluster == UINT32_MAX || end_cluster == UINT32_MAX || begin_cluster == end_cluster) {
+		return false;
+	}
+
+	const uint32_t stamp = r_scratch.stamp;
+	const Vector3 end_center = clusters[end_cluster].center;
+
+	gd::Heap<ClusterQueueEntry, ClusterQueueEntryCompare> &cluster_to_visit = r_scratch.cluster_to_visit;
+	cluster_to_visit.clear();
+
+	r_scratch.cluster_visited_stamps[begin_cluster] = stamp;
+	r_scratch.cluster_costs[begin_cluster] = 0.0;
+	r_scratch.cluster_parents[begin_cluster] = UINT32_MAX;
+	cluster_to_visit.push({ clusters[begin_cluster].center.distance_to(end_center), begin_cluster });
+
+	bool found = false;
+	while (!cluster_to_visit.is_empty()) {
+		const uint32_t cluster_id = cluster_to_visit.pop().cluster;
+		if (r_scratch.cluster_closed_stamps[cluster_id] == stamp) {
+			// Stale entry, this cluster was already reached with a lower cost.
+			continue;
+		}
+		r_scratch.cluster_closed_stamps[cluster_id] = stamp;
+
+		if (cluster_id == end_cluster) {
+			found = true;
+			break;
+		}
+
+		const PolygonCluster &cluster = clusters[cluster_id];
+		for (uint32_t i = 0; i < cluster.neighbors.size(); i++) {
+			if ((p_navigation_layers & cluster.neighbor_navigation_layers[i]) == 0) {
+				continue;
+			}
+			const uint32_t neighbor_id = cluster.neighbors[i];
+			const real_t cost = r_scratch.cluster_costs[cluster_id] + cluster.center.distance_to(clusters[neighbor_id].center);
+			if (r_scratch.cluster_visited_stamps[neighbor_id] != stamp || cost < r_scratch.cluster_costs[neighbor_id]) {
+				r_scratch.cluster_visited_stamps[neighbor_id] = stamp;
+				r_scratch.cluster_costs[neighbor_id] = cost;
+				r_scratch.cluster_parents[neighbor_id] = cluster_id;
+				cluster_to_visit.push({ cost + clusters[neighbor_id].center.distance_to(end_center), neighbor_id });
+			}
+		}
+	}
+
+	if (!found) {
+		return false;
+	}
+
+	// Allow the clusters along the corridor and their direct neighbors, cluster centers are only
+	// a rough estimate and the best polygon path may cut through the side of the corridor.
+	for (uint32_t cluster_id = end_cluster; cluster_id != UINT32_MAX; cluster_id = r_scratch.cluster_parents[cluster_id]) {
+		r_scratch.cluster_allowed_stamps[cluster_id] = stamp;
+		for (uint32_t neighbor_id : clusters[cluster_id].neighbors) {
+			r_scratch.cluster_allowed_stamps[neighbor_id] = stamp;
+		}
+	}
+
+	return true;
 }
 
 void NavMap::add_region(NavRegion *p_region) {
@@ -943,6 +1293,7 @@ void NavMap::sync() {
 			const LocalVector<gd::Polygon> &polygons_source = region->get_polygons();
 			for (uint32_t n = 0; n < polygons_source.size(); n++) {
 				polygons[count + n] = polygons_source[n];
+				polygons[count + n].id = count + n;
 			}
 			count += region->get_polygons().size();
 		}
@@ -1060,6 +1411,8 @@ void NavMap::sync() {
 			}
 		}
 
+		_update_polygon_bvh();
+
 		uint32_t link_poly_idx = 0;
 		link_polygons.resize(links.size());
 
@@ -1072,53 +1425,31 @@ void NavMap::sync() {
 			const Vector3 end = link->get_end_position();
 
 			gd::Polygon *closest_start_polygon = nullptr;
-			real_t closest_start_distance = link_connection_radius;
 			Vector3 closest_start_point;
 
 			gd::Polygon *closest_end_polygon = nullptr;
-			real_t closest_end_distance = link_connection_radius;
 			Vector3 closest_end_point;
 
-			// Create link to any polygons within the search radius of the start point.
-			for (uint32_t start_index = 0; start_index < polygons.size(); start_index++) {
-				gd::Polygon &start_poly = polygons[start_index];
-
-				// For each face check the distance to the start
-				for (uint32_t start_point_id = 2; start_point_id < start_poly.points.size(); start_point_id += 1) {
-					const Face3 start_face(start_poly.points[0].pos, start_poly.points[start_point_id - 1].pos, start_poly.points[start_point_id].pos);
-					const Vector3 start_point = start_face.get_closest_point_to(start);
-					const real_t start_distance = start_point.distance_to(start);
-
-					// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-					if (start_distance <= link_connection_radius && start_distance < closest_start_distance) {
-						closest_start_distance = start_distance;
-						closest_start_point = start_point;
-						closest_start_polygon = &start_poly;
-					}
-				}
+			// Create link to the closest polygons within the search radius of the start and end points.
+			Vector3 closest_point;
+			const gd::Polygon *start_poly = _get_closest_polygon(start, false, 0, closest_point);
+			if (start_poly && closest_point.distance_to(start) <= link_connection_radius) {
+				closest_start_point = closest_point;
+				closest_start_polygon = const_cast<gd::Polygon *>(start_poly);
 			}
 
-			// Find any polygons within the search radius of the end point.
-			for (gd::Polygon &end_poly : polygons) {
-				// For each face check the distance to the end
-				for (uint32_t end_point_id = 2; end_point_id < end_poly.points.size(); end_point_id += 1) {
-					const Face3 end_face(end_poly.points[0].pos, end_poly.points[end_point_id - 1].pos, end_poly.points[end_point_id].pos);
-					const Vector3 end_point = end_face.get_closest_point_to(end);
-					const real_t end_distance = end_point.distance_to(end);
-
-					// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-					if (end_distance <= link_connection_radius && end_distance < closest_end_distance) {
-						closest_end_distance = end_distance;
-						closest_end_point = end_point;
-						closest_end_polygon = &end_poly;
-					}
-				}
+			const gd::Polygon *end_poly = _get_closest_polygon(end, false, 0, closest_point);
+			if (end_poly && closest_point.distance_to(end) <= link_connection_radius) {
+				closest_end_point = closest_point;
+				closest_end_polygon = const_cast<gd::Polygon *>(end_poly);
 			}
 
 			// If we have both a start and end point, then create a synthetic polygon to route through.
 			if (closest_start_polygon && closest_end_polygon) {
-				gd::Polygon &new_polygon = link_polygons[link_poly_idx++];
+				gd::Polygon &new_polygon = link_polygons[link_poly_idx];
 				new_polygon.owner = link;
+				new_polygon.id = polygons.size() + link_poly_idx;
+				link_poly_idx++;
 
 				new_polygon.edges.clear();
 				new_polygon.edges.resize(4);
@@ -1174,6 +1505,8 @@ void NavMap::sync() {
 			}
 		}
 
+		_update_clusters(link_poly_idx);
+
 		// Some code treats 0 as a failure case, so we avoid returning 0 and modulo wrap UINT32_MAX manually.
 		iteration_id = iteration_id % UINT32_MAX + 1;
 	}
@@ -1420,6 +1753,8 @@ void NavMap::_update_merge_rasterizer_cell_dimensions() {
 NavMap::NavMap() {
 	avoidance_use_multiple_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_multiple_threads");
 	avoidance_use_high_priority_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_high_priority_threads");
+	use_hierarchical_pathfinding = GLOBAL_GET("navigation/pathfinding/use_hierarchical_pathfinding");
+	hierarchical_pathfinding_min_distance = GLOBAL_GET("navigation/pathfinding/hierarchical_pathfinding_min_distance");
 }
 
 NavMap::~NavMap() {
@@ -46,6 +46,7 @@ class NavLink;
 class NavRegion;
 class NavAgent;
 class NavObstacle;
+struct NavMapPathQueryScratch;
 
 class NavMap : public NavRid {
 	RWLock map_rwlock;
@@ -84,6 +85,31 @@ class NavMap : public NavRid {
 	/// Map polygons
 	LocalVector<gd::Polygon> polygons;
 
+	/// Bounding volume hierarchy over the map polygons, used to find the polygon closest
+	/// to a point without testing every face of the map.
+	struct PolygonBVHNode {
+		AABB aabb;
+		/// Leaves store their first entry in `polygon_bvh_indices`, inner nodes the index of their second child.
+		uint32_t first_or_right = 0;
+		uint32_t count = 0;
+	};
+	LocalVector<PolygonBVHNode> polygon_bvh;
+	LocalVector<uint32_t> polygon_bvh_indices;
+	LocalVector<AABB> polygon_aabbs;
+
+	/// Hierarchical pathfinding layer, groups of connected polygons.
+	/// Long path queries first search a corridor of clusters and then only expand the polygons inside it.
+	struct PolygonCluster {
+		Vector3 center;
+		LocalVector<uint32_t> neighbors;
+		/// Navigation layers of the polygons that can be entered from this cluster, per neighbor.
+		LocalVector<uint32_t> neighbor_navigation_layers;
+	};
+	LocalVector<PolygonCluster> clusters;
+
+	bool use_hierarchical_pathfinding = false;
+	real_t hierarchical_pathfinding_min_distance = 50.0;
+
 	/// RVO avoidance worlds
 	RVO2D::RVOSimulator2D rvo_simulation_2d;
 	RVO3D::RVOSimulator3D rvo_simulation_3d;
@@ -230,6 +256,12 @@ private:
 	void _update_rvo_agents_tree_3d();
 
 	void _update_merge_rasterizer_cell_dimensions();
+
+	uint32_t _build_polygon_bvh_node(uint32_t p_first, uint32_t p_count);
+	void _update_polygon_bvh();
+	void _update_clusters(uint32_t p_link_polygon_count);
+	const gd::Polygon *_get_closest_polygon(const Vector3 &p_point, bool p_use_navigation_layers, uint32_t p_navigation_layers, Vector3 &r_closest_point, Vector3 *r_normal = nullptr) const;
+	bool _find_cluster_corridor(const gd::Polygon *p_begin_poly, const gd::Polygon *p_end_poly, uint32_t p_navigation_layers, NavMapPathQueryScratch &r_scratch) const;
 };
 
 #endif // NAV_MAP_H
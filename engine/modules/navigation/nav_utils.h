@@ -114,6 +114,12 @@ struct Polygon {
 	Vector3 center;
 
 	real_t surface_area = 0.0;
+
+	/// Index of this `Polygon` in the map, region polygons come first, then link polygons.
+	uint32_t id = 0;
+
+	/// Cluster this `Polygon` belongs to in the map's hierarchical pathfinding layer.
+	uint32_t cluster_id = UINT32_MAX;
 };
 
 struct NavigationPoly {
@@ -131,6 +137,10 @@ struct NavigationPoly {
 	Vector3 entry;
 	/// The distance to the destination.
 	real_t traveled_distance = 0.0;
+	/// The traveled distance plus the estimated remaining cost, used to sort the open set.
+	real_t total_cost = 0.0;
+	/// Position of this poly in the open set heap, UINT32_MAX when not in it.
+	uint32_t heap_index = UINT32_MAX;
 
 	NavigationPoly() { poly = nullptr; }
 
@@ -146,6 +156,96 @@ struct NavigationPoly {
 	}
 };
 
+template <typename T>
+struct NoopIndexer {
+	void operator()(const T &p_value, uint32_t p_index) {}
+};
+
+/**
+ * Binary min-heap. The indexer is told whenever an element moves, so that callers
+ * can keep track of where each element is and use `shift()` after lowering its key.
+ */
+template <typename T, typename LessThan, typename Indexer = NoopIndexer<T>>
+class Heap {
+	LocalVector<T> _buffer;
+
+	void _shift_up(uint32_t p_index) {
+		T value = _buffer[p_index];
+		while (p_index > 0) {
+			const uint32_t parent_index = (p_index - 1) / 2;
+			if (!less_than(value, _buffer[parent_index])) {
+				break;
+			}
+			_buffer[p_index] = _buffer[parent_index];
+			indexer(_buffer[p_index], p_index);
+			p_index = parent_index;
+		}
+		_buffer[p_index] = value;
+		indexer(value, p_index);
+	}
+
+	void _shift_down(uint32_t p_index) {
+		T value = _buffer[p_index];
+		const uint32_t size = _buffer.size();
+		while (true) {
+			uint32_t child_index = p_index * 2 + 1;
+			if (child_index >= size) {
+				break;
+			}
+			if (child_index + 1 < size && less_than(_buffer[child_index + 1], _buffer[child_index])) {
+				child_index++;
+			}
+			if (!less_than(_buffer[child_index], value)) {
+				break;
+			}
+			_buffer[p_index] = _buffer[child_index];
+			indexer(_buffer[p_index], p_index);
+			p_index = child_index;
+		}
+		_buffer[p_index] = value;
+		indexer(value, p_index);
+	}
+
+public:
+	LessThan less_than;
+	Indexer indexer;
+
+	void reserve(uint32_t p_size) { _buffer.reserve(p_size); }
+	uint32_t size() const { return _buffer.size(); }
+	bool is_empty() const { return _buffer.is_empty(); }
+
+	void push(const T &p_value) {
+		_buffer.push_back(p_value);
+		_shift_up(_buffer.size() - 1);
+	}
+
+	T pop() {
+		T top = _buffer[0];
+		indexer(top, UINT32_MAX);
+		const uint32_t last_index = _buffer.size() - 1;
+		if (last_index > 0) {
+			_buffer[0] = _buffer[last_index];
+			_buffer.resize(last_index);
+			_shift_down(0);
+		} else {
+			_buffer.resize(0);
+		}
+		return top;
+	}
+
+	/// Restores the heap order after the key of the element at `p_index` was lowered.
+	void shift(uint32_t p_index) {
+		_shift_up(p_index);
+	}
+
+	void clear() {
+		for (const T &value : _buffer) {
+			indexer(value, UINT32_MAX);
+		}
+		_buffer.clear();
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
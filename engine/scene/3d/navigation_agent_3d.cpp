@@ -105,6 +105,11 @@ void NavigationAgent3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_simplify_epsilon", "epsilon"), &NavigationAgent3D::set_simplify_epsilon);
 	ClassDB::bind_method(D_METHOD("get_simplify_epsilon"), &NavigationAgent3D::get_simplify_epsilon);
 
+	ClassDB::bind_method(D_METHOD("set_use_async_path_queries", "enabled"), &NavigationAgent3D::set_use_async_path_queries);
+	ClassDB::bind_method(D_METHOD("get_use_async_path_queries"), &NavigationAgent3D::get_use_async_path_queries);
+
+	ClassDB::bind_method(D_METHOD("is_path_query_pending"), &NavigationAgent3D::is_path_query_pending);
+
 	ClassDB::bind_method(D_METHOD("get_next_path_position"), &NavigationAgent3D::get_next_path_position);
 
 	ClassDB::bind_method(D_METHOD("set_velocity_forced", "velocity"), &NavigationAgent3D::set_velocity_forced);
@@ -148,6 +153,7 @@ void NavigationAgent3D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "path_metadata_flags", PROPERTY_HINT_FLAGS, "Include Types,Include RIDs,Include Owners"), "set_path_metadata_flags", "get_path_metadata_flags");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "simplify_path"), "set_simplify_path", "get_simplify_path");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "simplify_epsilon", PROPERTY_HINT_RANGE, "0.0,10.0,0.001,or_greater,suffix:m"), "set_simplify_epsilon", "get_simplify_epsilon");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_async_path_queries"), "set_use_async_path_queries", "get_use_async_path_queries");
 
 	ADD_GROUP("Avoidance", "");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "avoidance_enabled"), "set_avoidance_enabled", "get_avoidance_enabled");
@@ -350,6 +356,8 @@ NavigationAgent3D::NavigationAgent3D() {
 	navigation_result = Ref<NavigationPathQueryResult3D>();
 	navigation_result.instantiate();
 
+	async_navigation_result.instantiate();
+
 #ifdef DEBUG_ENABLED
 	NavigationServer3D::get_singleton()->connect(SNAME("navigation_debug_changed"), callable_mp(this, &NavigationAgent3D::_navigation_debug_changed));
 #endif // DEBUG_ENABLED
@@ -490,6 +498,18 @@ real_t NavigationAgent3D::get_simplify_epsilon() const {
 	return simplify_epsilon;
 }
 
+void NavigationAgent3D::set_use_async_path_queries(bool p_enabled) {
+	use_async_path_queries = p_enabled;
+}
+
+bool NavigationAgent3D::get_use_async_path_queries() const {
+	return use_async_path_queries;
+}
+
+bool NavigationAgent3D::is_path_query_pending() const {
+	return async_path_query_pending || async_repath_requested;
+}
+
 void NavigationAgent3D::set_path_metadata_flags(BitField<NavigationPathQueryParameters3D::PathMetadataFlags> p_path_metadata_flags) {
 	if (path_metadata_flags == p_path_metadata_flags) {
 		return;
@@ -745,6 +765,8 @@ void NavigationAgent3D::_update_navigation() {
 
 	if (NavigationServer3D::get_singleton()->agent_is_map_changed(agent)) {
 		reload_path = true;
+	} else if (async_repath_requested) {
+		reload_path = true;
 	} else if (navigation_result->get_path().size() == 0) {
 		reload_path = true;
 	} else {
@@ -765,7 +787,8 @@ void NavigationAgent3D::_update_navigation() {
 		}
 	}
 
-	if (reload_path) {
+	// Only one async query is in flight at a time, a repath requested meanwhile is sent once it arrives.
+	if (reload_path && !async_path_query_pending) {
 		navigation_query->set_start_position(origin);
 		navigation_query->set_target_position(target_position);
 		navigation_query->set_navigation_layers(navigation_layers);
@@ -777,14 +800,14 @@ void NavigationAgent3D::_update_navigation() {
 			navigation_query->set_map(agent_parent->get_world_3d()->get_navigation_map());
 		}
 
-		NavigationServer3D::get_singleton()->query_path(navigation_query, navigation_result);
-#ifdef DEBUG_ENABLED
-		debug_path_dirty = true;
-#endif // DEBUG_ENABLED
-		navigation_finished = false;
-		last_waypoint_reached = false;
-		navigation_path_index = 0;
-		emit_signal(SNAME("path_changed"));
+		async_repath_requested = false;
+		if (use_async_path_queries) {
+			async_path_query_pending = true;
+			NavigationServer3D::get_singleton()->query_path_async(navigation_query, async_navigation_result, callable_mp(this, &NavigationAgent3D::_async_path_query_completed));
+		} else {
+			NavigationServer3D::get_singleton()->query_path(navigation_query, navigation_result);
+			_path_changed();
+		}
 	}
 
 	if (navigation_result->get_path().size() == 0) {
@@ -806,7 +829,8 @@ void NavigationAgent3D::_update_navigation() {
 		// Advance waypoints if possible.
 		_advance_waypoints(origin);
 		// Keep navigation running even after reaching the last waypoint if the target is reachable.
-		if (last_waypoint_reached && !_is_target_reachable()) {
+		// While a new path is on its way the old one may not lead to the target, so wait for it.
+		if (last_waypoint_reached && !is_path_query_pending() && !_is_target_reachable()) {
 			_transition_to_navigation_finished();
 		}
 	}
@@ -830,8 +854,33 @@ void NavigationAgent3D::_advance_waypoints(const Vector3 &p_origin) {
 	}
 }
 
+void NavigationAgent3D::_path_changed() {
+#ifdef DEBUG_ENABLED
+	debug_path_dirty = true;
+#endif // DEBUG_ENABLED
+	navigation_finished = false;
+	last_waypoint_reached = false;
+	navigation_path_index = 0;
+	emit_signal(SNAME("path_changed"));
+}
+
+void NavigationAgent3D::_async_path_query_completed() {
+	async_path_query_pending = false;
+
+	// Even if the target changed since this query was sent, its result is still newer than the current path.
+	// Dropping it would leave an agent that retargets every frame without ever getting a path, a repath requested
+	// meanwhile is sent on the next update instead.
+	SWAP(navigation_result, async_navigation_result);
+	_path_changed();
+}
+
 void NavigationAgent3D::_request_repath() {
-	navigation_result->reset();
+	if (use_async_path_queries) {
+		// Keep following the current path until the new one arrives.
+		async_repath_requested = true;
+	} else {
+		navigation_result->reset();
+	}
 	target_reached = false;
 	navigation_finished = false;
 	last_waypoint_reached = false;
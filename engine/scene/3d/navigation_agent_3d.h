@@ -68,6 +68,7 @@ class NavigationAgent3D : public Node {
 	real_t path_max_distance = 5.0;
 	bool simplify_path = false;
 	real_t simplify_epsilon = 0.0;
+	bool use_async_path_queries = false;
 
 	Vector3 target_position;
 
@@ -75,6 +76,11 @@ class NavigationAgent3D : public Node {
 	Ref<NavigationPathQueryResult3D> navigation_result;
 	int navigation_path_index = 0;
 
+	// Async path queries write into their own result, the current path is kept until it arrives.
+	Ref<NavigationPathQueryResult3D> async_navigation_result;
+	bool async_path_query_pending = false;
+	bool async_repath_requested = false;
+
 	// the velocity result of the avoidance simulation step
 	Vector3 safe_velocity;
 
@@ -208,6 +214,11 @@ public:
 	void set_simplify_epsilon(real_t p_epsilon);
 	real_t get_simplify_epsilon() const;
 
+	void set_use_async_path_queries(bool p_enabled);
+	bool get_use_async_path_queries() const;
+
+	bool is_path_query_pending() const;
+
 	Vector3 get_next_path_position();
 
 	Ref<NavigationPathQueryResult3D> get_current_navigation_result() const { return navigation_result; }
@@ -265,6 +276,8 @@ private:
 	void _update_navigation();
 	void _advance_waypoints(const Vector3 &p_origin);
 	void _request_repath();
+	void _path_changed();
+	void _async_path_query_completed();
 
 	bool _is_last_waypoint() const;
 	void _move_to_next_waypoint();
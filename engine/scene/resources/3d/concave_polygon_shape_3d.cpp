@@ -73,6 +73,9 @@ void ConcavePolygonShape3D::_update_shape() {
 	Dictionary d;
 	d["faces"] = faces;
 	d["backface_collision"] = backface_collision;
+	if (!physics_cache.is_empty()) {
+		d["physics_cache"] = physics_cache;
+	}
 	PhysicsServer3D::get_singleton()->shape_set_data(get_shape(), d);
 
 	Shape3D::_update_shape();
@@ -101,6 +104,31 @@ bool ConcavePolygonShape3D::is_backface_collision_enabled() const {
 	return backface_collision;
 }
 
+void ConcavePolygonShape3D::set_physics_cache(const Vector<uint8_t> &p_cache) {
+	physics_cache = p_cache;
+
+	if (!faces.is_empty()) {
+		_update_shape();
+		emit_changed();
+	}
+}
+
+Vector<uint8_t> ConcavePolygonShape3D::get_physics_cache() const {
+	return physics_cache;
+}
+
+void ConcavePolygonShape3D::bake_physics_cache() {
+	PhysicsServer3D *physics_server = PhysicsServer3D::get_singleton();
+
+	// Only some physics servers support this, in which case there is nothing to bake.
+	if (faces.is_empty() || !physics_server->has_method("shape_bake_cache")) {
+		physics_cache.clear();
+		return;
+	}
+
+	physics_cache = physics_server->call("shape_bake_cache", get_shape());
+}
+
 void ConcavePolygonShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_faces", "faces"), &ConcavePolygonShape3D::set_faces);
 	ClassDB::bind_method(D_METHOD("get_faces"), &ConcavePolygonShape3D::get_faces);
@@ -108,8 +136,13 @@ void ConcavePolygonShape3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_backface_collision_enabled", "enabled"), &ConcavePolygonShape3D::set_backface_collision_enabled);
 	ClassDB::bind_method(D_METHOD("is_backface_collision_enabled"), &ConcavePolygonShape3D::is_backface_collision_enabled);
 
+	ClassDB::bind_method(D_METHOD("set_physics_cache", "cache"), &ConcavePolygonShape3D::set_physics_cache);
+	ClassDB::bind_method(D_METHOD("get_physics_cache"), &ConcavePolygonShape3D::get_physics_cache);
+	ClassDB::bind_method(D_METHOD("bake_physics_cache"), &ConcavePolygonShape3D::bake_physics_cache);
+
 	ADD_PROPERTY(PropertyInfo(Variant::PACKED_VECTOR3_ARRAY, "data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL), "set_faces", "get_faces");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "backface_collision"), "set_backface_collision_enabled", "is_backface_collision_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_BYTE_ARRAY, "physics_cache", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL), "set_physics_cache", "get_physics_cache");
 }
 
 ConcavePolygonShape3D::ConcavePolygonShape3D() :
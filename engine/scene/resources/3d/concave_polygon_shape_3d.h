@@ -38,6 +38,8 @@ class ConcavePolygonShape3D : public Shape3D {
 
 	Vector<Vector3> faces;
 	bool backface_collision = false;
+	// Opaque, physics server specific data that lets the server skip building its own representation of the faces
+	Vector<uint8_t> physics_cache;
 
 	struct DrawEdge {
 		Vector3 a;
@@ -71,6 +73,10 @@ public:
 	void set_backface_collision_enabled(bool p_enabled);
 	bool is_backface_collision_enabled() const;
 
+	void set_physics_cache(const Vector<uint8_t> &p_cache);
+	Vector<uint8_t> get_physics_cache() const;
+	void bake_physics_cache();
+
 	virtual Vector<Vector3> get_debug_mesh_lines() const override;
 	virtual real_t get_enclosing_radius() const override;
 
@@ -190,6 +190,15 @@ public:
 	void finish() override {}
 
 	NavigationUtilities::PathQueryResult _query_path(const NavigationUtilities::PathQueryParameters &p_parameters) const override { return NavigationUtilities::PathQueryResult(); }
+	void query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) override {
+		// There is nothing to query, but whoever is waiting on the result still needs to hear back.
+		if (p_query_result.is_valid()) {
+			p_query_result->reset();
+		}
+		if (p_callback.is_valid()) {
+			p_callback.call();
+		}
+	}
 	int get_process_info(ProcessInfo p_info) const override { return 0; }
 
 	void set_debug_enabled(bool p_enabled) {}
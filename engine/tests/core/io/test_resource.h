@@ -110,6 +110,38 @@ TEST_CASE("[Resource] Saving and loading") {
 			"The loaded child resource name should be equal to the expected value.");
 }
 
+TEST_CASE("[Resource] Loading binary resources with parallel external dependencies") {
+	const bool parallel_dependency_loading = ResourceLoader::is_parallel_dependency_loading_enabled();
+	ResourceLoader::set_parallel_dependency_loading(true);
+
+	const int child_count = 4;
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("resource_with_dependencies.res");
+	{
+		Ref<Resource> resource = memnew(Resource);
+		for (int i = 0; i < child_count; i++) {
+			Ref<Resource> child_resource = memnew(Resource);
+			child_resource->set_name("Child " + itos(i));
+			const String child_path = OS::get_singleton()->get_cache_path().path_join("resource_dependency_" + itos(i) + ".res");
+			ResourceSaver::save(child_resource, child_path);
+			child_resource->set_path(child_path);
+			resource->set_meta("child_" + itos(i), child_resource);
+		}
+		ResourceSaver::save(resource, save_path);
+	}
+
+	const Ref<Resource> &loaded_resource = ResourceLoader::load(save_path);
+	REQUIRE(loaded_resource.is_valid());
+	for (int i = 0; i < child_count; i++) {
+		const Ref<Resource> &loaded_child_resource = loaded_resource->get_meta("child_" + itos(i));
+		REQUIRE(loaded_child_resource.is_valid());
+		CHECK_MESSAGE(
+				loaded_child_resource->get_name() == "Child " + itos(i),
+				"External dependencies loaded in parallel should be assigned to the right properties.");
+	}
+
+	ResourceLoader::set_parallel_dependency_loading(parallel_dependency_loading);
+}
+
 TEST_CASE("[Resource] Breaking circular references on save") {
 	Ref<Resource> resource_a = memnew(Resource);
 	resource_a->set_name("A");
@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MESSAGE_QUEUE_H
+#define TEST_MESSAGE_QUEUE_H
+
+#include "core/object/message_queue.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+struct DeferredCallRecorder {
+	static inline LocalVector<int> last_sequence;
+	static inline int call_count = 0;
+	static inline bool out_of_order = false;
+
+	static void record(int p_producer, int p_sequence) {
+		if (last_sequence[p_producer] != p_sequence - 1) {
+			out_of_order = true;
+		}
+		last_sequence[p_producer] = p_sequence;
+		call_count++;
+	}
+
+	static void reset(int p_producers) {
+		last_sequence.resize(p_producers);
+		for (int &sequence : last_sequence) {
+			sequence = -1;
+		}
+		call_count = 0;
+		out_of_order = false;
+	}
+};
+
+struct DeferredCallProducer {
+	static const int CALLS = 1000;
+	int index = 0;
+	int first_sequence = 0;
+	Thread thread;
+
+	static void push_calls(void *p_userdata) {
+		DeferredCallProducer *producer = (DeferredCallProducer *)p_userdata;
+		Callable callable = callable_mp_static(&DeferredCallRecorder::record);
+		for (int i = 0; i < CALLS; i++) {
+			MessageQueue::get_singleton()->push_callable(callable, producer->index, producer->first_sequence + i);
+		}
+	}
+};
+
+TEST_CASE("[MessageQueue] Deferred calls pushed from many threads keep their order per thread") {
+	const int producer_count = 16;
+	DeferredCallRecorder::reset(producer_count);
+
+	DeferredCallProducer producers[producer_count];
+	for (int i = 0; i < producer_count; i++) {
+		producers[i].index = i;
+		producers[i].thread.start(&DeferredCallProducer::push_calls, &producers[i]);
+	}
+	for (int i = 0; i < producer_count; i++) {
+		producers[i].thread.wait_to_finish();
+	}
+
+	// The threads have exited by now, their messages must still be delivered.
+	CHECK(MessageQueue::get_singleton()->has_messages());
+	MessageQueue::get_singleton()->flush();
+
+	CHECK_FALSE(DeferredCallRecorder::out_of_order);
+	CHECK(DeferredCallRecorder::call_count == producer_count * DeferredCallProducer::CALLS);
+	CHECK_FALSE(MessageQueue::get_singleton()->has_messages());
+}
+
+TEST_CASE("[MessageQueue] Calls from other threads run after the ones already queued") {
+	DeferredCallRecorder::reset(1);
+	MessageQueue::get_singleton()->push_callable(callable_mp_static(&DeferredCallRecorder::record), 0, 0);
+
+	DeferredCallProducer producer;
+	producer.first_sequence = 1;
+	producer.thread.start(&DeferredCallProducer::push_calls, &producer);
+	producer.thread.wait_to_finish();
+
+	MessageQueue::get_singleton()->flush();
+
+	CHECK_FALSE(DeferredCallRecorder::out_of_order);
+	CHECK(DeferredCallRecorder::call_count == DeferredCallProducer::CALLS + 1);
+}
+
+} // namespace TestMessageQueue
+
+#endif // TEST_MESSAGE_QUEUE_H
@@ -35,6 +35,8 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
 
 #include "tests/test_macros.h"
 
@@ -500,6 +502,75 @@ TEST_CASE("[Object] Notification order") { // GH-52325
 	memdelete(test_notification_object);
 }
 
+struct ObjectDBThreadData {
+	static const int ITERATIONS = 2000;
+	LocalVector<ObjectID> shared_ids;
+	LocalVector<Object *> shared_objects;
+	SafeFlag failed;
+};
+
+static void _objectdb_thread_func(void *p_userdata) {
+	ObjectDBThreadData *data = (ObjectDBThreadData *)p_userdata;
+	LocalVector<Object *> objects;
+	LocalVector<ObjectID> freed_ids;
+	objects.reserve(ObjectDBThreadData::ITERATIONS);
+	freed_ids.reserve(ObjectDBThreadData::ITERATIONS);
+
+	for (int i = 0; i < ObjectDBThreadData::ITERATIONS; i++) {
+		Object *object = memnew(Object);
+		objects.push_back(object);
+		if (ObjectDB::get_instance(object->get_instance_id()) != object) {
+			data->failed.set();
+		}
+		uint32_t shared_idx = i % data->shared_ids.size();
+		if (ObjectDB::get_instance(data->shared_ids[shared_idx]) != data->shared_objects[shared_idx]) {
+			data->failed.set();
+		}
+		if (i % 3 == 0) {
+			Object *to_free = objects[objects.size() / 2];
+			objects.remove_at_unordered(objects.size() / 2);
+			freed_ids.push_back(to_free->get_instance_id());
+			memdelete(to_free);
+		}
+	}
+
+	for (const ObjectID &id : freed_ids) {
+		if (ObjectDB::get_instance(id) != nullptr) {
+			data->failed.set();
+		}
+	}
+	for (Object *object : objects) {
+		memdelete(object);
+	}
+}
+
+TEST_CASE("[Object] ObjectDB lookups while other threads create and free objects") {
+	ObjectDBThreadData data;
+	for (int i = 0; i < 16; i++) {
+		Object *object = memnew(Object);
+		data.shared_objects.push_back(object);
+		data.shared_ids.push_back(object->get_instance_id());
+	}
+	const int object_count = ObjectDB::get_object_count();
+
+	const int thread_count = 4;
+	Thread threads[thread_count];
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].start(_objectdb_thread_func, &data);
+	}
+	for (int i = 0; i < thread_count; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	CHECK_FALSE_MESSAGE(data.failed.is_set(), "Instance lookups must never return a wrong or freed object.");
+	CHECK(ObjectDB::get_object_count() == object_count);
+
+	for (Object *object : data.shared_objects) {
+		memdelete(object);
+	}
+	CHECK(ObjectDB::get_instance(data.shared_ids[0]) == nullptr);
+}
+
 } // namespace TestObject
 
 #endif // TEST_OBJECT_H
@@ -0,0 +1,97 @@
+/**************************************************************************/
+/*  test_frame_arena.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+#ifndef TEST_FRAME_ARENA_H
+#define TEST_FRAME_ARENA_H
+
+#include "core/os/frame_arena.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFrameArena {
+
+TEST_CASE("[FrameArena] Allocations are aligned and rewound at the start of a frame") {
+	FrameArena::begin_frame();
+
+	uint8_t *first = static_cast<uint8_t *>(FrameArena::alloc(3, 1));
+	CHECK(uintptr_t(FrameArena::alloc(8, 64)) % 64 == 0);
+	CHECK(uintptr_t(FrameArena::alloc_array<double>(4)) % alignof(double) == 0);
+
+	FrameArena::begin_frame();
+	CHECK(FrameArena::alloc(3, 1) == first);
+}
+
+TEST_CASE("[FrameArena] Last allocation grows in place") {
+	FrameArena::begin_frame();
+
+	uint8_t *mem = static_cast<uint8_t *>(FrameArena::alloc(16));
+	mem[0] = 42;
+	CHECK(FrameArena::realloc(mem, 16, 128) == mem);
+
+	FrameArena::alloc(16);
+	uint8_t *moved = static_cast<uint8_t *>(FrameArena::realloc(mem, 128, 256));
+	CHECK(moved != mem);
+	CHECK(moved[0] == 42);
+}
+
+TEST_CASE("[FrameArena] Allocations larger than a chunk") {
+	FrameArena::begin_frame();
+
+	const size_t size = 1024 * 1024;
+	uint8_t *mem = static_cast<uint8_t *>(FrameArena::alloc(size));
+	memset(mem, 1, size);
+	uint8_t *next = static_cast<uint8_t *>(FrameArena::alloc(16));
+	CHECK((next < mem || next >= mem + size));
+
+	// Usage is recorded when the arena is rewound.
+	FrameArena::begin_frame();
+	CHECK(FrameArena::get_high_water_mark() >= size);
+}
+
+TEST_CASE("[FrameArena] FrameLocalVector") {
+	FrameArena::begin_frame();
+
+	FrameLocalVector<int> vector;
+	for (int i = 0; i < 1000; i++) {
+		vector.push_back(i);
+	}
+	FrameArena::alloc(16);
+	vector.push_back(1000);
+
+	bool all_kept = true;
+	for (int i = 0; i <= 1000; i++) {
+		all_kept &= vector[i] == i;
+	}
+	CHECK(vector.size() == 1001);
+	CHECK(all_kept);
+}
+
+} // namespace TestFrameArena
+
+#endif // TEST_FRAME_ARENA_H
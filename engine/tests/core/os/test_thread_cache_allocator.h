@@ -0,0 +1,135 @@
+/**************************************************************************/
+/*  test_thread_cache_allocator.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+#ifndef TEST_THREAD_CACHE_ALLOCATOR_H
+#define TEST_THREAD_CACHE_ALLOCATOR_H
+
+#include "core/os/thread.h"
+#include "core/os/thread_cache_allocator.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestThreadCacheAllocator {
+
+TEST_CASE("[ThreadCacheAllocator] Blocks are aligned and keep their contents on realloc") {
+	bool all_aligned = true;
+	bool all_kept = true;
+	for (size_t size = 1; size < ThreadCacheAllocator::MAX_SMALL_SIZE * 2; size += 37) {
+		uint8_t *mem = (uint8_t *)ThreadCacheAllocator::alloc(size);
+		all_aligned &= uintptr_t(mem) % alignof(max_align_t) == 0;
+		for (size_t i = 0; i < size; i++) {
+			mem[i] = uint8_t(i);
+		}
+
+		mem = (uint8_t *)ThreadCacheAllocator::realloc(mem, size * 3);
+		all_aligned &= uintptr_t(mem) % alignof(max_align_t) == 0;
+		for (size_t i = 0; i < size; i++) {
+			all_kept &= mem[i] == uint8_t(i);
+		}
+
+		mem = (uint8_t *)ThreadCacheAllocator::realloc(mem, size / 2 + 1);
+		for (size_t i = 0; i < size / 2 + 1; i++) {
+			all_kept &= mem[i] == uint8_t(i);
+		}
+		ThreadCacheAllocator::free(mem);
+	}
+	CHECK(all_aligned);
+	CHECK(all_kept);
+}
+
+TEST_CASE("[ThreadCacheAllocator] Freed blocks are reused by the same thread") {
+	void *mem = ThreadCacheAllocator::alloc(48);
+	ThreadCacheAllocator::free(mem);
+	CHECK(ThreadCacheAllocator::alloc(40) == mem);
+	ThreadCacheAllocator::free(mem);
+}
+
+struct CrossThreadFreeData {
+	static const int BLOCK_COUNT = 10000;
+	void *blocks[BLOCK_COUNT] = {};
+};
+
+static void cross_thread_free(void *p_userdata) {
+	CrossThreadFreeData *data = (CrossThreadFreeData *)p_userdata;
+	for (int i = 0; i < CrossThreadFreeData::BLOCK_COUNT; i++) {
+		ThreadCacheAllocator::free(data->blocks[i]);
+	}
+}
+
+TEST_CASE("[ThreadCacheAllocator] Blocks freed by other threads return to their owner") {
+	CrossThreadFreeData data;
+	for (int i = 0; i < CrossThreadFreeData::BLOCK_COUNT; i++) {
+		data.blocks[i] = ThreadCacheAllocator::alloc(64);
+		memset(data.blocks[i], 0xFF, 64);
+	}
+
+	// Set up before freeing, nothing may allocate from the tested size class until the blocks are back.
+	HashSet<void *> freed_blocks;
+	freed_blocks.reserve(CrossThreadFreeData::BLOCK_COUNT);
+	for (int i = 0; i < CrossThreadFreeData::BLOCK_COUNT; i++) {
+		freed_blocks.insert(data.blocks[i]);
+	}
+	LocalVector<void *> blocks;
+	blocks.reserve(CrossThreadFreeData::BLOCK_COUNT * 2);
+
+	Thread thread;
+	thread.start(cross_thread_free, &data);
+	thread.wait_to_finish();
+
+	// The blocks only come back once the local free list runs out, leave room for what was already in there.
+	for (int i = 0; i < CrossThreadFreeData::BLOCK_COUNT * 2 && !freed_blocks.is_empty(); i++) {
+		void *mem = ThreadCacheAllocator::alloc(64);
+		freed_blocks.erase(mem);
+		blocks.push_back(mem);
+	}
+	CHECK(freed_blocks.is_empty());
+
+	for (void *mem : blocks) {
+		ThreadCacheAllocator::free(mem);
+	}
+}
+
+TEST_CASE("[ThreadCacheAllocator] Usage is added up across threads") {
+	const uint64_t usage = ThreadCacheAllocator::get_usage();
+
+	ThreadCacheAllocator::add_usage(1000);
+	CHECK(ThreadCacheAllocator::get_usage() == usage + 1000);
+	CHECK(ThreadCacheAllocator::get_max_usage() >= usage + 1000);
+
+	Thread thread;
+	thread.start([](void *) { ThreadCacheAllocator::add_usage(-1000); }, nullptr);
+	thread.wait_to_finish();
+	CHECK(ThreadCacheAllocator::get_usage() == usage);
+}
+
+} // namespace TestThreadCacheAllocator
+
+#endif // TEST_THREAD_CACHE_ALLOCATOR_H
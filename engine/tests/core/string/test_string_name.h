@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/os/thread.h"
+#include "core/string/string_name.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	const StringName from_cstr = StringName("test_string_name_interning");
+	const StringName from_string = StringName(String("test_string_name_interning"));
+	const StringName from_static = SNAME("test_string_name_interning");
+
+	CHECK(from_cstr == from_string);
+	CHECK(from_cstr == from_static);
+	CHECK(from_cstr.data_unique_pointer() == from_string.data_unique_pointer());
+	CHECK(StringName::search("test_string_name_interning") == from_cstr);
+	CHECK(StringName::search("test_string_name_not_interned") == StringName());
+}
+
+struct ContentionTestData {
+	static const int NAME_COUNT = 64;
+	static const int ITERATIONS = 2000;
+	const void *expected[NAME_COUNT] = {};
+	SafeNumeric<uint32_t> mismatches;
+};
+
+static void contention_test_thread(void *p_userdata) {
+	ContentionTestData *data = (ContentionTestData *)p_userdata;
+	for (int i = 0; i < ContentionTestData::ITERATIONS; i++) {
+		const int name_idx = i % ContentionTestData::NAME_COUNT;
+		// Half the names are kept alive by the test, the other half are created and freed
+		// concurrently from every thread.
+		const StringName name = StringName(vformat("test_string_name_contention_%d", name_idx));
+		if (data->expected[name_idx] && name.data_unique_pointer() != data->expected[name_idx]) {
+			data->mismatches.increment();
+		}
+		const StringName transient = StringName(vformat("test_string_name_transient_%d", name_idx));
+		if (transient != StringName(String(transient))) {
+			data->mismatches.increment();
+		}
+	}
+}
+
+TEST_CASE("[StringName] Concurrent interning and release") {
+	ContentionTestData data;
+	LocalVector<StringName> kept_alive;
+	for (int i = 0; i < ContentionTestData::NAME_COUNT; i += 2) {
+		kept_alive.push_back(StringName(vformat("test_string_name_contention_%d", i)));
+		data.expected[i] = kept_alive[kept_alive.size() - 1].data_unique_pointer();
+	}
+
+	const int THREAD_COUNT = 8;
+	Thread threads[THREAD_COUNT];
+	for (int i = 0; i < THREAD_COUNT; i++) {
+		threads[i].start(contention_test_thread, &data);
+	}
+	for (int i = 0; i < THREAD_COUNT; i++) {
+		threads[i].wait_to_finish();
+	}
+
+	CHECK(data.mismatches.get() == 0);
+	for (int i = 0; i < ContentionTestData::NAME_COUNT; i += 2) {
+		CHECK(StringName(vformat("test_string_name_contention_%d", i)).data_unique_pointer() == data.expected[i]);
+	}
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
@@ -0,0 +1,153 @@
+/**************************************************************************/
+/*  test_flat_hash_map.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FLAT_HASH_MAP_H
+#define TEST_FLAT_HASH_MAP_H
+
+#include "core/string/string_name.h"
+#include "core/templates/flat_hash_map.h"
+#include "core/templates/flat_hash_set.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFlatHashMap {
+
+TEST_CASE("[FlatHashMap] Insert, overwrite and erase elements") {
+	FlatHashMap<int, int> map;
+	FlatHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+
+	map.insert(42, 1234);
+	CHECK(map[42] == 1234);
+	CHECK(map.size() == 1);
+
+	map.remove(map.find(42));
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+	CHECK(map.is_empty());
+}
+
+TEST_CASE("[FlatHashMap] Many elements with StringName keys") {
+	const int elem_max = 5000;
+	FlatHashMap<StringName, int> map;
+	for (int i = 0; i < elem_max; i++) {
+		map.insert(StringName("key_" + itos(i)), i);
+	}
+	CHECK(map.size() == elem_max);
+
+	for (int i = 0; i < elem_max; i += 2) {
+		CHECK(map.erase(StringName("key_" + itos(i))));
+	}
+	CHECK(map.size() == elem_max / 2);
+
+	bool all_found = true;
+	for (int i = 0; i < elem_max; i++) {
+		const int *value = map.getptr(StringName("key_" + itos(i)));
+		all_found &= (i % 2 == 0) ? value == nullptr : (value != nullptr && *value == i);
+	}
+	CHECK(all_found);
+
+	int sum = 0;
+	for (const KeyValue<StringName, int> &E : map) {
+		sum += E.value;
+	}
+	CHECK(sum == (elem_max / 2) * (elem_max / 2));
+}
+
+TEST_CASE("[FlatHashMap] Erasing while iterating and reusing tombstones") {
+	FlatHashMap<int, int> map;
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i, i);
+	}
+	for (const KeyValue<int, int> &E : map) {
+		if (E.key % 3 == 0) {
+			map.erase(E.key);
+		}
+	}
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key % 3 != 0);
+	}
+
+	// Churn must not grow the table, as deleted slots are reused or rehashed away.
+	const uint32_t capacity = map.get_capacity();
+	for (int i = 0; i < 100000; i++) {
+		map.insert(1000 + i, i);
+		map.erase(1000 + i);
+	}
+	CHECK(map.get_capacity() == capacity);
+	CHECK(map.size() == 666);
+}
+
+TEST_CASE("[FlatHashMap] Copy and clear") {
+	FlatHashMap<int, int> map;
+	for (int i = 0; i < 100; i++) {
+		map[i] = i * 2;
+	}
+
+	const FlatHashMap<int, int> copy = map;
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(copy.size() == 100);
+	CHECK(copy[50] == 100);
+}
+
+TEST_CASE("[FlatHashSet] Insert, iterate and erase elements") {
+	FlatHashSet<int> set;
+	for (int i = 0; i < 1000; i++) {
+		set.insert(i);
+	}
+	set.insert(10);
+	CHECK(set.size() == 1000);
+
+	for (int i = 0; i < 1000; i += 5) {
+		set.erase(i);
+	}
+
+	int count = 0;
+	for (const int &K : set) {
+		CHECK(K % 5 != 0);
+		count++;
+	}
+	CHECK(count == 800);
+	CHECK(set.has(1));
+	CHECK(!set.has(5));
+
+	set.reset();
+	CHECK(set.is_empty());
+	CHECK(set.get_capacity() == 0);
+}
+
+} // namespace TestFlatHashMap
+
+#endif // TEST_FLAT_HASH_MAP_H
@@ -0,0 +1,122 @@
+/**************************************************************************/
+/*  test_work_stealing_queue.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_WORK_STEALING_QUEUE_H
+#define TEST_WORK_STEALING_QUEUE_H
+
+#include "core/os/thread.h"
+#include "core/templates/work_stealing_queue.h"
+
+#include "tests/test_macros.h"
+
+namespace TestWorkStealingQueue {
+
+TEST_CASE("[WorkStealingQueue] Owner pops LIFO, thieves steal FIFO") {
+	WorkStealingQueue<int> queue(4);
+	CHECK(queue.is_empty());
+
+	for (int i = 0; i < 10; i++) {
+		queue.push(i);
+	}
+	CHECK(queue.size() == 10);
+
+	int value = -1;
+	CHECK(queue.pop(value));
+	CHECK(value == 9);
+	CHECK(queue.steal(value));
+	CHECK(value == 0);
+	CHECK(queue.steal(value));
+	CHECK(value == 1);
+	CHECK(queue.pop(value));
+	CHECK(value == 8);
+	CHECK(queue.size() == 6);
+
+	while (queue.pop(value)) {
+	}
+	CHECK(queue.is_empty());
+	CHECK_FALSE(queue.pop(value));
+	CHECK_FALSE(queue.steal(value));
+}
+
+struct StealTestData {
+	WorkStealingQueue<int> queue = WorkStealingQueue<int>(16);
+	LocalVector<SafeNumeric<uint32_t>> taken;
+	SafeFlag done;
+};
+
+static void steal_test_thief(void *p_userdata) {
+	StealTestData *data = (StealTestData *)p_userdata;
+	int value = 0;
+	while (!data->done.is_set() || !data->queue.is_empty()) {
+		if (data->queue.steal(value)) {
+			data->taken[value].increment();
+		}
+	}
+}
+
+TEST_CASE("[WorkStealingQueue] Every element is taken exactly once under contention") {
+	const int ELEMENT_COUNT = 100000;
+	const int THIEF_COUNT = 4;
+
+	StealTestData data;
+	data.taken.resize(ELEMENT_COUNT);
+
+	Thread thieves[THIEF_COUNT];
+	for (int i = 0; i < THIEF_COUNT; i++) {
+		thieves[i].start(steal_test_thief, &data);
+	}
+
+	int value = 0;
+	for (int i = 0; i < ELEMENT_COUNT; i++) {
+		data.queue.push(i);
+		if (i % 3 == 0 && data.queue.pop(value)) {
+			data.taken[value].increment();
+		}
+	}
+	while (data.queue.pop(value)) {
+		data.taken[value].increment();
+	}
+
+	data.done.set();
+	for (int i = 0; i < THIEF_COUNT; i++) {
+		thieves[i].wait_to_finish();
+	}
+
+	bool all_taken_once = true;
+	for (int i = 0; i < ELEMENT_COUNT; i++) {
+		// Reduce number of check messages.
+		all_taken_once &= data.taken[i].get() == 1;
+	}
+	CHECK(all_taken_once);
+}
+
+} // namespace TestWorkStealingQueue
+
+#endif // TEST_WORK_STEALING_QUEUE_H
@@ -106,6 +106,47 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static void static_nested_leaf_test(void *p_arg) {
+	counter[(uintptr_t)p_arg].increment();
+}
+static void static_nested_test(void *p_arg) {
+	// Posted from a pool thread, so these go through its work queue and may get stolen.
+	const uintptr_t base = (uintptr_t)p_arg * 8;
+	WorkerThreadPool::TaskID subtasks[8];
+	for (uintptr_t i = 0; i < 8; i++) {
+		subtasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_leaf_test, (void *)(base + i), true);
+	}
+	for (uintptr_t i = 0; i < 8; i++) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(subtasks[i]);
+	}
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_group_test, (void *)0, 8, 2, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+}
+TEST_CASE("[WorkerThreadPool] Process tasks posted from pool threads") {
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 4.0f));
+
+		counter.clear();
+		counter.resize(count * 8);
+		LocalVector<WorkerThreadPool::TaskID> tasks;
+		tasks.resize(count);
+		for (int i = 0; i < count; i++) {
+			tasks[i] = WorkerThreadPool::get_singleton()->add_native_task(static_nested_test, (void *)(uintptr_t)i, true);
+		}
+		for (int i = 0; i < count; i++) {
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(tasks[i]);
+		}
+
+		bool all_run = true;
+		for (int i = 0; i < count * 8; i++) {
+			// Every element runs once as a leaf task, the first 8 once more per group task.
+			const int expected = 1 + (i < 8 ? count : 0);
+			all_run &= counter[i].get() == expected;
+		}
+		CHECK(all_run);
+	}
+}
+
 } // namespace TestWorkerThreadPool
 
 #endif // TEST_WORKER_THREAD_POOL_H
@@ -34,6 +34,8 @@
 #include "scene/3d/navigation_agent_3d.h"
 #include "scene/3d/node_3d.h"
 #include "scene/main/window.h"
+#include "scene/resources/3d/primitive_meshes.h"
+#include "servers/navigation_server_3d.h"
 
 #include "tests/test_macros.h"
 
@@ -64,6 +66,96 @@ TEST_SUITE("[Navigation]") {
 		memdelete(agent_node);
 		memdelete(node_3d);
 	}
+
+	TEST_CASE("[SceneTree][NavigationAgent3D] Async path queries should apply a path while the target keeps changing") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(10.0, 0.001, 10.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		REQUIRE_NE(navigation_mesh->get_polygon_count(), 0);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		Node3D *node_3d = memnew(Node3D);
+		SceneTree::get_singleton()->get_root()->add_child(node_3d);
+		NavigationAgent3D *agent_node = memnew(NavigationAgent3D);
+		node_3d->add_child(agent_node);
+		agent_node->set_navigation_map(map);
+		agent_node->set_use_async_path_queries(true);
+
+		// Retarget every frame, so that there is always a repath requested while a query is in flight.
+		for (int i = 0; i < 10 && agent_node->get_current_navigation_path().is_empty(); i++) {
+			agent_node->set_target_position(Vector3(3.0, 0.0, 3.0 + 0.01 * i));
+			agent_node->get_next_path_position();
+			navigation_server->process(0.0);
+		}
+
+		CHECK_FALSE(agent_node->get_current_navigation_path().is_empty());
+		CHECK(agent_node->is_path_query_pending());
+
+		memdelete(agent_node);
+		memdelete(node_3d);
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to actually remove map.
+	}
+
+	TEST_CASE("[SceneTree][NavigationAgent3D] Async path queries should be answered while the server is inactive") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(10.0, 0.001, 10.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		REQUIRE_NE(navigation_mesh->get_polygon_count(), 0);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		navigation_server->set_active(false);
+
+		Node3D *node_3d = memnew(Node3D);
+		SceneTree::get_singleton()->get_root()->add_child(node_3d);
+		NavigationAgent3D *agent_node = memnew(NavigationAgent3D);
+		node_3d->add_child(agent_node);
+		agent_node->set_navigation_map(map);
+		agent_node->set_use_async_path_queries(true);
+
+		agent_node->set_target_position(Vector3(3.0, 0.0, 3.0));
+		agent_node->get_next_path_position();
+		CHECK(agent_node->is_path_query_pending());
+
+		// One cycle to dispatch the query and another one to deliver its result.
+		navigation_server->process(0.0);
+		navigation_server->process(0.0);
+
+		CHECK_FALSE(agent_node->is_path_query_pending());
+		CHECK_FALSE(agent_node->get_current_navigation_path().is_empty());
+
+		navigation_server->set_active(true);
+		memdelete(agent_node);
+		memdelete(node_3d);
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to actually remove map.
+	}
 }
 
 } //namespace TestNavigationAgent3D
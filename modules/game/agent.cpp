@@ -32,6 +32,10 @@
 #include "modules/game/agent_parkour.h"
 #include "modules/game/game_main_loop.h"
 #include "modules/game/game_world.h"
+#include "modules/jolt/src/objects/jolt_body_impl_3d.hpp"
+#include "modules/jolt/src/servers/jolt_physics_server_3d.hpp"
+#include "modules/jolt/src/spaces/jolt_physics_direct_space_state_3d.hpp"
+#include "modules/jolt/src/spaces/jolt_query_filter_3d.hpp"
 #include "physics_layers.h"
 #include "springs.h"
 
@@ -141,20 +145,29 @@ Quaternion HBAgent::get_graphics_rotation() const { return graphics_rotation; }
 void HBAgent::set_graphics_rotation(const Quaternion &p_graphics_rotation) { graphics_rotation = p_graphics_rotation; }
 
 Vector<HBAgent *> HBAgent::find_nearby_agents(float p_radius) const {
-	Ref<SphereShape3D> sphere;
-	sphere.instantiate();
-	sphere->set_radius(p_radius);
+	// When physics runs on a separate thread the singleton is a PhysicsServer3DWrapMT, even though the
+	// space state is still Jolt's.
+	JoltPhysicsServer3D *jolt_server = Object::cast_to<JoltPhysicsServer3D>(PhysicsServer3D::get_singleton());
+	ERR_FAIL_NULL_V(jolt_server, Vector<HBAgent *>());
+	JoltPhysicsDirectSpaceState3D *dss = Object::cast_to<JoltPhysicsDirectSpaceState3D>(get_world_3d()->get_direct_space_state());
+	ERR_FAIL_NULL_V(dss, Vector<HBAgent *>());
+
+	JoltQueryFilter3D query_filter(*dss, HBPhysicsLayers::LAYER_PLAYER, true, false);
+	if (const JoltBodyImpl3D *jolt_body = jolt_server->get_body(get_rid())) {
+		query_filter.exclude_body(jolt_body->get_jolt_id());
+	}
 
-	PhysicsDirectSpaceState3D *dss = get_world_3d()->get_direct_space_state();
-	PhysicsDirectSpaceState3D::ShapeParameters params;
-	params.shape_rid = sphere->get_rid();
-	params.transform.origin = get_global_position();
-	params.collision_mask = HBPhysicsLayers::LAYER_PLAYER;
-	params.exclude.insert(get_rid());
+	// Jolt shapes can live on the stack as long as they are marked as embedded, this saves us from
+	// creating a shape resource (and its physics server counterpart) on every call
+	JPH::SphereShape sphere(p_radius);
+	sphere.SetEmbedded();
+
+	Transform3D sphere_transform;
+	sphere_transform.origin = get_global_position();
 
 	const int RESULT_COUNT = 5;
 	PhysicsDirectSpaceState3D::ShapeResult results[RESULT_COUNT];
-	int result_count = dss->intersect_shape(params, results, RESULT_COUNT);
+	int result_count = dss->query_shape(sphere, sphere_transform, 0.0f, query_filter, results, RESULT_COUNT);
 
 	Vector<HBAgent *> agents;
 
@@ -168,7 +181,12 @@ Vector<HBAgent *> HBAgent::find_nearby_agents(float p_radius) const {
 	return agents;
 }
 
-void HBAgent::set_ledge_detector_node(const NodePath &ledge_detector_path_) { ledge_detector_path = ledge_detector_path_; }
+void HBAgent::set_ledge_detector_node(const NodePath &ledge_detector_path_) {
+	ledge_detector_path = ledge_detector_path_;
+	if (is_ready()) {
+		_update_ledge_detector_connection();
+	}
+}
 
 void HBAgent::add_attack(const Ref<HBAttackData> &p_attack_data) {
 	ERR_FAIL_COND(attack_datas.has(p_attack_data->get_name()));
@@ -455,6 +473,39 @@ void HBAgent::_physics_process(float p_delta) {
 	prev_graphics_rotation = _get_graphics_node()->get_global_basis().get_rotation_quaternion();
 }
 
+void HBAgent::_physics_frame_started() {
+	JoltCharacterBody3D::_physics_frame_started();
+	Node3D *gn = _get_graphics_node();
+	if (!gn) {
+		return;
+	}
+	// Put the graphics node back where the last tick left it, so gameplay code never sees the interpolated transform
+	if (graphics_interpolated) {
+		gn->set_global_transform(graphics_physics_transform);
+		graphics_interpolated = false;
+	} else {
+		graphics_physics_transform = gn->get_global_transform();
+	}
+	graphics_previous_physics_transform = graphics_physics_transform;
+}
+
+void HBAgent::_interpolate_graphics_node() {
+	if (!is_physics_interpolated_and_enabled()) {
+		return;
+	}
+	Node3D *gn = _get_graphics_node();
+	if (!gn) {
+		return;
+	}
+	// The first idle frame after a tick captures what the tick left behind before overwriting it
+	if (!graphics_interpolated) {
+		graphics_physics_transform = gn->get_global_transform();
+		graphics_interpolated = true;
+	}
+	const real_t fraction = Engine::get_singleton()->get_physics_interpolation_fraction();
+	gn->set_global_transform(graphics_previous_physics_transform.interpolate_with(graphics_physics_transform, fraction));
+}
+
 bool HBAgent::is_at_edge(Vector3 p_direction) {
 	ERR_FAIL_COND_V(!p_direction.is_normalized(), false);
 	PhysicsDirectSpaceState3D *dss = get_world_3d()->get_direct_space_state();
@@ -480,18 +531,51 @@ Area3D *HBAgent::get_ledge_detector() const {
 	return ledge;
 }
 
-LocalVector<HBAgentParkourLedge *> HBAgent::get_overlapping_ledges() const {
-	LocalVector<HBAgentParkourLedge *> ledges;
+const LocalVector<HBAgentParkourLedge *> &HBAgent::get_overlapping_ledges() const {
+	// Without a connected detector we can't know when the overlaps change, so always rebuild
+	if (!overlapping_ledges_dirty && ledge_detector_cache.is_valid()) {
+		return overlapping_ledges_cache;
+	}
+	overlapping_ledges_cache.clear();
 	Area3D *ledge_detector = get_ledge_detector();
-	ERR_FAIL_NULL_V(ledge_detector, ledges);
+	ERR_FAIL_NULL_V(ledge_detector, overlapping_ledges_cache);
 	TypedArray<Area3D> overlapping_areas = ledge_detector->get_overlapping_areas();
 	for (int i = 0; i < overlapping_areas.size(); i++) {
 		HBAgentParkourLedge *ledge = Object::cast_to<HBAgentParkourLedge>(overlapping_areas[i]);
 		if (ledge) {
-			ledges.push_back(ledge);
+			overlapping_ledges_cache.push_back(ledge);
 		}
 	}
-	return ledges;
+	overlapping_ledges_dirty = false;
+	return overlapping_ledges_cache;
+}
+
+void HBAgent::_update_ledge_detector_connection() {
+	overlapping_ledges_dirty = true;
+	const Callable on_changed = callable_mp(this, &HBAgent::_on_ledge_detector_overlaps_changed).unbind(1);
+
+	Area3D *old_detector = Object::cast_to<Area3D>(ObjectDB::get_instance(ledge_detector_cache));
+	if (old_detector) {
+		old_detector->disconnect("area_entered", on_changed);
+		old_detector->disconnect("area_exited", on_changed);
+	}
+	ledge_detector_cache = ObjectID();
+
+	if (ledge_detector_path.is_empty()) {
+		return;
+	}
+	Area3D *detector = Object::cast_to<Area3D>(get_node_or_null(ledge_detector_path));
+	if (!detector) {
+		return;
+	}
+	// Ledges leaving the tree or the detector stopping monitoring also go through area_exited
+	detector->connect("area_entered", on_changed);
+	detector->connect("area_exited", on_changed);
+	ledge_detector_cache = detector->get_instance_id();
+}
+
+void HBAgent::_on_ledge_detector_overlaps_changed() {
+	overlapping_ledges_dirty = true;
 }
 
 bool HBAgent::is_action_pressed(AgentInputAction p_action) const {
@@ -590,6 +674,7 @@ void HBAgent::_notification(int p_what) {
 			if (Engine::get_singleton()->is_editor_hint()) {
 				return;
 			}
+			_update_ledge_detector_connection();
 			Node3D *gn = _get_graphics_node();
 			set_graphics_rotation(Basis::from_euler(Vector3(0.0f, starting_heading, 0.0f)));
 			if (gn) {
@@ -598,6 +683,8 @@ void HBAgent::_notification(int p_what) {
 				last_last_rotation = current_rotation;
 				last_rotation = current_rotation;
 				rotation_spring_target = gn->get_global_transform().basis.get_rotation_quaternion();
+				graphics_physics_transform = gn->get_global_transform();
+				graphics_previous_physics_transform = graphics_physics_transform;
 			}
 		} break;
 		case NOTIFICATION_PHYSICS_PROCESS: {
@@ -621,8 +708,16 @@ void HBAgent::_notification(int p_what) {
 			UNREGISTER_DEBUG(this);
 #endif
 		} break;
-#ifdef DEBUG_ENABLED
+		case NOTIFICATION_RESET_PHYSICS_INTERPOLATION: {
+			Node3D *gn = _get_graphics_node();
+			if (gn && !graphics_interpolated) {
+				graphics_physics_transform = gn->get_global_transform();
+			}
+			graphics_previous_physics_transform = graphics_physics_transform;
+		} break;
 		case NOTIFICATION_INTERNAL_PROCESS: {
+			_interpolate_graphics_node();
+#ifdef DEBUG_ENABLED
 			GodotImGui *gim = GodotImGui::get_singleton();
 			if (gim && gim->is_debug_enabled(this)) {
 				if (gim->begin_debug_window(this)) {
@@ -659,8 +754,8 @@ void HBAgent::_notification(int p_what) {
 				}
 				ImGui::End();
 			}
-		} break;
 #endif
+		} break;
 	}
 }
 
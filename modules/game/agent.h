@@ -220,6 +220,10 @@ public:
 private:
 	Ref<ShaderMaterial> outline_material;
 	NodePath ledge_detector_path;
+	ObjectID ledge_detector_cache;
+	// Snapshot of the ledges overlapping the ledge detector, only rebuilt after the detector reports a change
+	mutable LocalVector<HBAgentParkourLedge *> overlapping_ledges_cache;
+	mutable bool overlapping_ledges_dirty = true;
 	struct InputState {
 		Vector3 movement;
 		Quaternion movement_input_rotation;
@@ -255,6 +259,8 @@ private:
 	Quaternion last_last_rotation;
 
 	void _update_graphics_node_cache();
+	void _update_ledge_detector_connection();
+	void _on_ledge_detector_overlaps_changed();
 	Node3D *_get_graphics_node();
 	void _rotate_towards_velocity(float p_delta);
 	void _tilt_towards_acceleration(float p_delta);
@@ -266,6 +272,12 @@ private:
 	Quaternion graphics_rotation;
 	Quaternion prev_graphics_rotation;
 	Vector3 prev_graphics_position;
+	// Graphics node transform as left by the latest physics tick and as it was at the start of it,
+	// interpolated between on idle frames when physics interpolation is enabled
+	Transform3D graphics_physics_transform;
+	Transform3D graphics_previous_physics_transform;
+	bool graphics_interpolated = false;
+	void _interpolate_graphics_node();
 	ObjectID target_agent;
 	bool is_player_controlled = false;
 	bool is_parrying = false;
@@ -281,6 +293,7 @@ private:
 protected:
 	static void _bind_methods();
 	void _notification(int p_what);
+	virtual void _physics_frame_started() override;
 	Ref<HBAgentConstants> _get_agent_constants() const;
 	Vector3 _get_desired_velocity() const;
 
@@ -330,7 +343,7 @@ public:
 	void reset_desired_input_velocity_to(const Vector3 &p_new_vel);
 
 	Area3D *get_ledge_detector() const;
-	LocalVector<HBAgentParkourLedge *> get_overlapping_ledges() const;
+	const LocalVector<HBAgentParkourLedge *> &get_overlapping_ledges() const;
 
 	NodePath get_ledge_detector_node() const;
 	void set_ledge_detector_node(const NodePath &p_ledge_detector_node);
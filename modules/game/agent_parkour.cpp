@@ -32,11 +32,17 @@
 #include "modules/game/console_system.h"
 #include "physics_layers.h"
 
+#include "core/templates/hashfuncs.h"
+#include "core/templates/sort_array.h"
 #include "scene/resources/3d/box_shape_3d.h"
 #include "scene/resources/3d/sphere_shape_3d.h"
 
 CVar parkour_debug_enabled = CVar("parkour_debug", Variant::BOOL, false);
 
+static const float LEDGE_FRAME_INTERVAL = 0.05f;
+static const int LEDGE_BVH_LEAF_SIZE = 4;
+static const int LEDGE_BVH_MAX_DEPTH = 64;
+
 void HBAgentParkourPoint::_update_collision_shape() {
 	collision_shape_dirty = false;
 	if (!collision_shape) {
@@ -306,9 +312,252 @@ void HBAgentParkourLedge::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "closed"), "set_closed", "get_closed");
 }
 
+bool HBAgentParkourLedge::_set(const StringName &p_name, const Variant &p_value) {
+	if (p_name == SNAME("ledge_acceleration_data")) {
+		_set_acceleration_data(p_value);
+		return true;
+	}
+	return false;
+}
+
+bool HBAgentParkourLedge::_get(const StringName &p_name, Variant &r_ret) const {
+	if (p_name == SNAME("ledge_acceleration_data")) {
+		r_ret = _get_acceleration_data();
+		return true;
+	}
+	return false;
+}
+
+void HBAgentParkourLedge::_get_property_list(List<PropertyInfo> *p_list) const {
+	p_list->push_back(PropertyInfo(Variant::DICTIONARY, "ledge_acceleration_data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_INTERNAL));
+}
+
+void HBAgentParkourLedge::_on_curve_changed() {
+	acceleration_dirty = true;
+}
+
+uint32_t HBAgentParkourLedge::_get_curve_hash() const {
+	if (!curve.is_valid()) {
+		return 0;
+	}
+	uint32_t hash = hash_murmur3_one_32(curve->get_point_count());
+	hash = hash_murmur3_one_real(curve->get_bake_interval(), hash);
+	hash = hash_murmur3_one_32(curve->is_up_vector_enabled(), hash);
+	for (int i = 0; i < curve->get_point_count(); i++) {
+		const Vector3 points[3] = { curve->get_point_position(i), curve->get_point_in(i), curve->get_point_out(i) };
+		for (const Vector3 &point : points) {
+			hash = hash_murmur3_one_real(point.x, hash);
+			hash = hash_murmur3_one_real(point.y, hash);
+			hash = hash_murmur3_one_real(point.z, hash);
+		}
+		hash = hash_murmur3_one_real(curve->get_point_tilt(i), hash);
+	}
+	return hash_fmix32(hash);
+}
+
+void HBAgentParkourLedge::_clear_acceleration_structure() {
+	frame_interval = 0.0f;
+	frame_table_length = 0.0f;
+	frame_positions.clear();
+	frame_tangents.clear();
+	frame_ups.clear();
+	bvh_nodes.clear();
+	bvh_segments.clear();
+	agent_fits_mask.clear();
+}
+
+void HBAgentParkourLedge::_build_acceleration_structure() {
+	acceleration_dirty = false;
+	acceleration_hash_pending = false;
+	acceleration_curve_hash = _get_curve_hash();
+	_clear_acceleration_structure();
+
+	if (!curve.is_valid() || curve->get_point_count() < 2) {
+		return;
+	}
+
+	const float length = curve->get_baked_length();
+	if (length <= CMP_EPSILON) {
+		return;
+	}
+
+	const int sample_count = MAX(int(Math::ceil(length / LEDGE_FRAME_INTERVAL)) + 1, 2);
+	frame_interval = length / (sample_count - 1);
+	frame_table_length = length;
+
+	frame_positions.resize(sample_count);
+	frame_tangents.resize(sample_count);
+	frame_ups.resize(sample_count);
+
+	for (int i = 0; i < sample_count; i++) {
+		const Transform3D trf = curve->sample_baked_with_rotation(MIN(i * frame_interval, length));
+		frame_positions[i] = trf.origin;
+		frame_tangents[i] = -trf.basis.get_column(2);
+		frame_ups[i] = trf.basis.get_column(1);
+	}
+
+	const int segment_count = sample_count - 1;
+	bvh_segments.resize(segment_count);
+	for (int i = 0; i < segment_count; i++) {
+		bvh_segments[i] = i;
+	}
+	bvh_nodes.reserve(segment_count * 2 / LEDGE_BVH_LEAF_SIZE + 1);
+	_build_bvh_node(0, segment_count);
+}
+
+void HBAgentParkourLedge::_ensure_acceleration_structure() const {
+	HBAgentParkourLedge *self = const_cast<HBAgentParkourLedge *>(this);
+	if (acceleration_hash_pending) {
+		self->acceleration_hash_pending = false;
+		// Baked data from a different version of the curve would give us wrong results
+		if (_get_curve_hash() != acceleration_curve_hash) {
+			self->acceleration_dirty = true;
+		}
+	}
+	if (acceleration_dirty) {
+		self->_build_acceleration_structure();
+	}
+}
+
+int HBAgentParkourLedge::_build_bvh_node(int p_first, int p_count) {
+	const int node_idx = bvh_nodes.size();
+	bvh_nodes.push_back(LedgeBVHNode());
+
+	AABB aabb = AABB(frame_positions[bvh_segments[p_first]], Vector3());
+	for (int i = p_first; i < p_first + p_count; i++) {
+		aabb.expand_to(frame_positions[bvh_segments[i]]);
+		aabb.expand_to(frame_positions[bvh_segments[i] + 1]);
+	}
+	bvh_nodes[node_idx].aabb = aabb;
+
+	if (p_count <= LEDGE_BVH_LEAF_SIZE) {
+		bvh_nodes[node_idx].first_or_right = p_first;
+		bvh_nodes[node_idx].segment_count = p_count;
+		return node_idx;
+	}
+
+	// Median split along the longest axis, the first child always directly follows its parent
+	SortArray<int, LedgeBVHSegmentComparator> sorter;
+	sorter.compare.positions = &frame_positions;
+	sorter.compare.axis = aabb.get_longest_axis_index();
+	sorter.sort(bvh_segments.ptr() + p_first, p_count);
+
+	const int half = p_count / 2;
+	_build_bvh_node(p_first, half);
+	const int right_idx = _build_bvh_node(p_first + half, p_count - half);
+	bvh_nodes[node_idx].first_or_right = right_idx;
+	return node_idx;
+}
+
+Dictionary HBAgentParkourLedge::_get_acceleration_data() const {
+	Dictionary data;
+	if (frame_positions.size() < 2) {
+		return data;
+	}
+
+	PackedVector3Array positions;
+	PackedVector3Array tangents;
+	PackedVector3Array ups;
+	positions.resize(frame_positions.size());
+	tangents.resize(frame_positions.size());
+	ups.resize(frame_positions.size());
+	for (uint32_t i = 0; i < frame_positions.size(); i++) {
+		positions.set(i, frame_positions[i]);
+		tangents.set(i, frame_tangents[i]);
+		ups.set(i, frame_ups[i]);
+	}
+
+	PackedVector3Array bounds;
+	PackedInt32Array nodes;
+	bounds.resize(bvh_nodes.size() * 2);
+	nodes.resize(bvh_nodes.size() * 2);
+	for (uint32_t i = 0; i < bvh_nodes.size(); i++) {
+		bounds.set(i * 2, bvh_nodes[i].aabb.position);
+		bounds.set(i * 2 + 1, bvh_nodes[i].aabb.size);
+		nodes.set(i * 2, bvh_nodes[i].first_or_right);
+		nodes.set(i * 2 + 1, bvh_nodes[i].segment_count);
+	}
+
+	PackedInt32Array segments;
+	segments.resize(bvh_segments.size());
+	for (uint32_t i = 0; i < bvh_segments.size(); i++) {
+		segments.set(i, bvh_segments[i]);
+	}
+
+	data["curve_hash"] = acceleration_curve_hash;
+	data["frame_interval"] = frame_interval;
+	data["frame_positions"] = positions;
+	data["frame_tangents"] = tangents;
+	data["frame_ups"] = ups;
+	data["bvh_bounds"] = bounds;
+	data["bvh_nodes"] = nodes;
+	data["bvh_segments"] = segments;
+	return data;
+}
+
+void HBAgentParkourLedge::_set_acceleration_data(const Dictionary &p_data) {
+	_clear_acceleration_structure();
+	// Anything we can't use is rebuilt from the curve on first query
+	acceleration_dirty = true;
+
+	const PackedVector3Array positions = p_data.get("frame_positions", PackedVector3Array());
+	const PackedVector3Array tangents = p_data.get("frame_tangents", PackedVector3Array());
+	const PackedVector3Array ups = p_data.get("frame_ups", PackedVector3Array());
+	const PackedVector3Array bounds = p_data.get("bvh_bounds", PackedVector3Array());
+	const PackedInt32Array nodes = p_data.get("bvh_nodes", PackedInt32Array());
+	const PackedInt32Array segments = p_data.get("bvh_segments", PackedInt32Array());
+	const float interval = p_data.get("frame_interval", 0.0f);
+
+	// Data baked without a curve hash can't be validated
+	if (positions.size() < 2 || interval <= 0.0f || !p_data.has("curve_hash")) {
+		return;
+	}
+	ERR_FAIL_COND(tangents.size() != positions.size() || ups.size() != positions.size());
+	ERR_FAIL_COND(bounds.size() != nodes.size() || segments.size() != positions.size() - 1);
+
+	frame_interval = interval;
+	frame_table_length = interval * (positions.size() - 1);
+	frame_positions.resize(positions.size());
+	frame_tangents.resize(positions.size());
+	frame_ups.resize(positions.size());
+	for (int i = 0; i < positions.size(); i++) {
+		frame_positions[i] = positions[i];
+		frame_tangents[i] = tangents[i];
+		frame_ups[i] = ups[i];
+	}
+
+	bvh_nodes.resize(nodes.size() / 2);
+	for (uint32_t i = 0; i < bvh_nodes.size(); i++) {
+		bvh_nodes[i].aabb = AABB(bounds[i * 2], bounds[i * 2 + 1]);
+		bvh_nodes[i].first_or_right = nodes[i * 2];
+		bvh_nodes[i].segment_count = nodes[i * 2 + 1];
+	}
+
+	bvh_segments.resize(segments.size());
+	for (int i = 0; i < segments.size(); i++) {
+		bvh_segments[i] = segments[i];
+	}
+
+	acceleration_curve_hash = uint32_t(p_data["curve_hash"]);
+	acceleration_hash_pending = true;
+	acceleration_dirty = false;
+}
+
 Ref<Curve3D> HBAgentParkourLedge::get_curve() const { return curve; }
 
-void HBAgentParkourLedge::set_curve(const Ref<Curve3D> &p_curve) { curve = p_curve; }
+void HBAgentParkourLedge::set_curve(const Ref<Curve3D> &p_curve) {
+	if (curve == p_curve) {
+		return;
+	}
+	if (curve.is_valid()) {
+		curve->disconnect_changed(callable_mp(this, &HBAgentParkourLedge::_on_curve_changed));
+	}
+	curve = p_curve;
+	if (curve.is_valid()) {
+		curve->connect_changed(callable_mp(this, &HBAgentParkourLedge::_on_curve_changed));
+	}
+	acceleration_dirty = true;
+}
 
 void HBAgentParkourLedge::generate_colliders() {
 	ERR_FAIL_COND(!curve.is_valid());
@@ -468,17 +717,77 @@ void HBAgentParkourLedge::round_path() {
 		rounded_path->add_point(points[i].pos, points[i].in, points[i].out);
 	}
 
-	curve = rounded_path;
+	set_curve(rounded_path);
 }
 
 float HBAgentParkourLedge::get_closest_offset(const Vector3 &p_global_pos) const {
 	ERR_FAIL_COND_V(!curve.is_valid(), -1.0f);
-	return curve->get_closest_offset(to_local(p_global_pos));
+	_ensure_acceleration_structure();
+	const Vector3 local_pos = to_local(p_global_pos);
+	if (bvh_nodes.is_empty()) {
+		return curve->get_closest_offset(local_pos);
+	}
+
+	int stack[LEDGE_BVH_MAX_DEPTH];
+	int stack_size = 0;
+	stack[stack_size++] = 0;
+
+	float closest_dist_sq = FLT_MAX;
+	float closest_offset = 0.0f;
+
+	while (stack_size > 0) {
+		const int node_idx = stack[--stack_size];
+		const LedgeBVHNode &node = bvh_nodes[node_idx];
+
+		const Vector3 clamped = local_pos.clamp(node.aabb.position, node.aabb.position + node.aabb.size);
+		if (clamped.distance_squared_to(local_pos) > closest_dist_sq) {
+			continue;
+		}
+
+		if (node.segment_count == 0) {
+			ERR_FAIL_COND_V(stack_size + 2 > LEDGE_BVH_MAX_DEPTH, closest_offset);
+			stack[stack_size++] = node.first_or_right;
+			stack[stack_size++] = node_idx + 1;
+			continue;
+		}
+
+		for (int i = node.first_or_right; i < node.first_or_right + node.segment_count; i++) {
+			const int segment = bvh_segments[i];
+			const Vector3 a = frame_positions[segment];
+			const Vector3 a_b = frame_positions[segment + 1] - a;
+			const float length_sq = a_b.length_squared();
+			const float t = length_sq > 0.0f ? CLAMP((local_pos - a).dot(a_b) / length_sq, 0.0f, 1.0f) : 0.0f;
+			const float dist_sq = (a + a_b * t).distance_squared_to(local_pos);
+			if (dist_sq < closest_dist_sq) {
+				closest_dist_sq = dist_sq;
+				closest_offset = (segment + t) * frame_interval;
+			}
+		}
+	}
+
+	return closest_offset;
+}
+
+Transform3D HBAgentParkourLedge::sample_ledge_frame(float p_offset) const {
+	ERR_FAIL_COND_V(!curve.is_valid(), Transform3D());
+	_ensure_acceleration_structure();
+	if (frame_positions.size() < 2) {
+		return curve->sample_baked_with_rotation(Math::fposmod(p_offset, curve->get_baked_length()));
+	}
+
+	const float sample = Math::fposmod(p_offset, frame_table_length) / frame_interval;
+	const int idx = MIN(int(sample), int(frame_positions.size()) - 2);
+	const float frac = sample - idx;
+
+	Transform3D trf;
+	trf.origin = frame_positions[idx].lerp(frame_positions[idx + 1], frac);
+	trf.basis = Basis::looking_at(frame_tangents[idx].lerp(frame_tangents[idx + 1], frac), frame_ups[idx].lerp(frame_ups[idx + 1], frac));
+	return trf;
 }
 
 Transform3D HBAgentParkourLedge::get_ledge_transform_at_offset(float p_offset) const {
 	ERR_FAIL_COND_V(!curve.is_valid(), Transform3D());
-	Transform3D trf = curve->sample_baked_with_rotation(Math::fposmod(p_offset, curve->get_baked_length()));
+	Transform3D trf = sample_ledge_frame(p_offset);
 	Vector3 forward = trf.basis.get_column(2);
 	trf.basis = Basis::looking_at(-forward, Vector3(0.0f, 1.0f, 0.0f));
 	Quaternion rot = Quaternion(Vector3(0.0, 0.0, -1.0f), trf.basis.xform(Vector3(1.0f, 0.0f, 0.0f)));
@@ -496,18 +805,42 @@ Transform3D HBAgentParkourLedge::get_agent_ledge_transform_at_offset(float p_off
 }
 
 bool HBAgentParkourLedge::check_agent_fits(HBAgent *p_agent, float p_offset, HBDebugGeometry *p_debug_geo) const {
+	Ref<Shape3D> shape = p_agent->get_collision_shape();
+	const float agent_radius = p_agent->get_radius();
+	_ensure_acceleration_structure();
+
+	// World geometry doesn't move, so the result is cached per frame table sample and the query
+	// is done at the sample's offset, the mask is reset whenever the agent's shape changes.
+	int sample_idx = -1;
+	float offset = p_offset;
+	if (frame_positions.size() >= 2) {
+		if (agent_fits_shape != shape->get_rid() || agent_fits_radius != agent_radius || agent_fits_mask.size() != frame_positions.size()) {
+			agent_fits_shape = shape->get_rid();
+			agent_fits_radius = agent_radius;
+			agent_fits_mask.resize(frame_positions.size());
+			memset(agent_fits_mask.ptr(), AGENT_FITS_UNKNOWN, agent_fits_mask.size());
+		}
+		sample_idx = CLAMP(int(Math::round(Math::fposmod(p_offset, frame_table_length) / frame_interval)), 0, int(frame_positions.size()) - 1);
+		if (agent_fits_mask[sample_idx] != AGENT_FITS_UNKNOWN && !p_debug_geo) {
+			return agent_fits_mask[sample_idx] == AGENT_FITS_YES;
+		}
+		offset = sample_idx * frame_interval;
+	}
+
 	PhysicsDirectSpaceState3D *dss = p_agent->get_world_3d()->get_direct_space_state();
 	PhysicsDirectSpaceState3D::ShapeParameters shape_params;
 	shape_params.collision_mask = HBPhysicsLayers::LAYER_WORLD_GEO;
-	Transform3D ledge_trf = get_ledge_transform_at_offset(p_offset);
-	Ref<Shape3D> shape = p_agent->get_collision_shape();
+	Transform3D ledge_trf = get_ledge_transform_at_offset(offset);
 	shape_params.shape_rid = shape->get_rid();
-	shape_params.transform.origin = ledge_trf.origin + ledge_trf.basis.xform(Vector3(0.0, 0.0, p_agent->get_radius() + 0.1f));
+	shape_params.transform.origin = ledge_trf.origin + ledge_trf.basis.xform(Vector3(0.0, 0.0, agent_radius + 0.1f));
 	PhysicsDirectSpaceState3D::ShapeRestInfo rest_info;
 	bool hit = dss->rest_info(shape_params, &rest_info);
 	if (p_debug_geo) {
 		p_debug_geo->debug_cast_motion(shape, shape_params, Color("BLUE"));
 	}
+	if (sample_idx != -1) {
+		agent_fits_mask[sample_idx] = hit ? AGENT_FITS_NO : AGENT_FITS_YES;
+	}
 	return !hit;
 }
 
@@ -527,7 +860,9 @@ void HBAgentParkourLedge::_editor_build(const EntityCompileInfo &p_info, const H
 
 	DEV_ASSERT(ledge != nullptr);
 
-	curve.instantiate();
+	Ref<Curve3D> new_curve;
+	new_curve.instantiate();
+	set_curve(new_curve);
 	curve->add_point(get_global_position());
 
 	while (children.size() > 0) {
@@ -553,4 +888,5 @@ void HBAgentParkourLedge::_editor_build(const EntityCompileInfo &p_info, const H
 
 	generate_colliders();
 	generate_offset_path();
+	_build_acceleration_structure();
 }
@@ -31,6 +31,7 @@
 #define AGENT_PARKOUR_H
 
 #include "agent.h"
+#include "core/templates/local_vector.h"
 #include "debug_geometry.h"
 #include "modules/tbloader/src/tb_loader_singleton.h"
 #include "physics_layers.h"
@@ -47,10 +48,63 @@ class HBAgentParkourLedge : public Area3D, public TBLoaderEntity {
 
 	bool closed = false;
 
+	// Acceleration structure for runtime queries, baked on _editor_build and serialized with the ledge.
+	// The frame table holds the curve's rotation frame sampled at a fixed interval, the BVH is built
+	// over the segments between consecutive frame table samples.
+	struct LedgeBVHNode {
+		AABB aabb;
+		// Leaves store the first entry in bvh_segments, inner nodes the index of their second child
+		int first_or_right = 0;
+		int segment_count = 0;
+	};
+
+	struct LedgeBVHSegmentComparator {
+		const LocalVector<Vector3> *positions = nullptr;
+		int axis = 0;
+		bool operator()(int p_a, int p_b) const {
+			return (*positions)[p_a][axis] + (*positions)[p_a + 1][axis] < (*positions)[p_b][axis] + (*positions)[p_b + 1][axis];
+		}
+	};
+
+	enum AgentFitsState : uint8_t {
+		AGENT_FITS_UNKNOWN,
+		AGENT_FITS_YES,
+		AGENT_FITS_NO,
+	};
+
+	bool acceleration_dirty = true;
+	// Hash of the curve the acceleration structure was built from, baked data is only checked
+	// against the curve once on first query, later edits are caught by the curve's changed signal.
+	uint32_t acceleration_curve_hash = 0;
+	bool acceleration_hash_pending = false;
+	float frame_interval = 0.0f;
+	float frame_table_length = 0.0f;
+	LocalVector<Vector3> frame_positions;
+	LocalVector<Vector3> frame_tangents;
+	LocalVector<Vector3> frame_ups;
+	LocalVector<LedgeBVHNode> bvh_nodes;
+	LocalVector<int> bvh_segments;
+
+	// Occupancy mask along the ledge, one entry per frame table sample, filled lazily by check_agent_fits
+	mutable LocalVector<uint8_t> agent_fits_mask;
+	mutable RID agent_fits_shape;
+	mutable float agent_fits_radius = 0.0f;
+
 	void _on_parkour_debug_changed();
+	void _on_curve_changed();
+	uint32_t _get_curve_hash() const;
+	void _clear_acceleration_structure();
+	void _build_acceleration_structure();
+	void _ensure_acceleration_structure() const;
+	int _build_bvh_node(int p_first, int p_count);
+	Dictionary _get_acceleration_data() const;
+	void _set_acceleration_data(const Dictionary &p_data);
 
 protected:
 	static void _bind_methods();
+	bool _set(const StringName &p_name, const Variant &p_value);
+	bool _get(const StringName &p_name, Variant &r_ret) const;
+	void _get_property_list(List<PropertyInfo> *p_list) const;
 
 public:
 	Ref<Curve3D> get_curve() const;
@@ -60,6 +114,8 @@ public:
 	void round_path();
 	float get_closest_offset(const Vector3 &p_global_pos) const;
 	Transform3D get_ledge_transform_at_offset(float p_offset) const;
+	// Returns the curve's rotation frame at p_offset, equivalent to Curve3D::sample_baked_with_rotation
+	Transform3D sample_ledge_frame(float p_offset) const;
 	Transform3D get_agent_ledge_transform_at_offset(float p_offset) const;
 	bool check_agent_fits(HBAgent *p_agent, float p_offset, HBDebugGeometry *p_debug_geo = nullptr) const;
 
@@ -1367,7 +1367,7 @@ bool HBAgentGroundStateBase::handle_parkour_down() {
 	}
 
 	// Ledge drop check
-	Vector<HBAgentParkourLedge *> overlapping_ledges = agent->get_overlapping_ledges();
+	const LocalVector<HBAgentParkourLedge *> &overlapping_ledges = agent->get_overlapping_ledges();
 	for (HBAgentParkourLedge *ledge : overlapping_ledges) {
 		float offset = ledge->get_closest_offset(get_agent()->get_global_position());
 		Transform3D ledge_trf = ledge->get_ledge_transform_at_offset(offset);
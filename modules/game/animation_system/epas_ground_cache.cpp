@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*  epas_ground_cache.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                               SWANSONG                                 */
+/*                          https://eirteam.moe                           */
+/**************************************************************************/
+/* Copyright (c) 2023-present Álex Román Núñez (EIRTeam).                 */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "epas_ground_cache.h"
+
+EPASGroundCache::Cell &EPASGroundCache::_get_cell(int32_t p_x, int32_t p_z) {
+	const int32_t slot_x = Math::posmod(p_x, GRID_SIZE);
+	const int32_t slot_z = Math::posmod(p_z, GRID_SIZE);
+	return cells[slot_z * GRID_SIZE + slot_x];
+}
+
+bool EPASGroundCache::_matches(const Cell &p_cell, int32_t p_x, int32_t p_z, float p_from_y) const {
+	if (!p_cell.valid || p_cell.x != p_x || p_cell.z != p_z) {
+		return false;
+	}
+	if (Math::abs(p_cell.probe_y - p_from_y) > probe_height_tolerance) {
+		return false;
+	}
+	// A probe that started a bit higher than us may have hit something that is above our head.
+	return !p_cell.hit || p_cell.height <= p_from_y;
+}
+
+bool EPASGroundCache::_is_fresh(const Cell &p_cell, int32_t p_x, int32_t p_z, float p_from_y) const {
+	return _matches(p_cell, p_x, p_z, p_from_y) && !p_cell.dynamic && (frame - p_cell.refresh_frame) <= max_age_frames;
+}
+
+void EPASGroundCache::_probe(PhysicsDirectSpaceState3D *p_dss, Cell &p_cell, int32_t p_x, int32_t p_z, float p_from_y) {
+	probes_this_frame++;
+
+	PhysicsDirectSpaceState3D::RayParameters params;
+	params.collision_mask = collision_mask;
+	params.from = Vector3((p_x + 0.5f) * cell_size, p_from_y, (p_z + 0.5f) * cell_size);
+	params.to = params.from;
+	params.to.y = p_from_y - probe_depth;
+
+	PhysicsDirectSpaceState3D::RayResult result;
+	p_cell.x = p_x;
+	p_cell.z = p_z;
+	p_cell.valid = true;
+	p_cell.probe_y = p_from_y;
+	p_cell.refresh_frame = frame;
+	p_cell.hit = p_dss->intersect_ray(params, result);
+	p_cell.dynamic = false;
+	if (p_cell.hit) {
+		p_cell.height = result.position.y;
+		p_cell.normal = result.normal;
+		// Anything that isn't static might move under our feet, so it can't be cached.
+		p_cell.dynamic = PhysicsServer3D::get_singleton()->body_get_mode(result.rid) != PhysicsServer3D::BODY_MODE_STATIC;
+	}
+}
+
+void EPASGroundCache::begin_frame(const Vector3 &p_origin) {
+	frame++;
+	probes_this_frame = 0;
+	if (has_origin) {
+		// Big vertical moves (drops, ledge climbs) mean we are now standing on a different level.
+		const bool moved_vertically = Math::abs(origin.y - p_origin.y) > vertical_invalidation_distance;
+		if (moved_vertically || origin.distance_squared_to(p_origin) > invalidation_distance * invalidation_distance) {
+			invalidate();
+		}
+	}
+	origin = p_origin;
+	has_origin = true;
+}
+
+void EPASGroundCache::prefetch(PhysicsDirectSpaceState3D *p_dss, const Vector3 &p_position) {
+	if (probes_this_frame >= probe_budget) {
+		return;
+	}
+	const int32_t x = Math::floor(p_position.x / cell_size);
+	const int32_t z = Math::floor(p_position.z / cell_size);
+	Cell &cell = _get_cell(x, z);
+	if (!_is_fresh(cell, x, z, p_position.y)) {
+		_probe(p_dss, cell, x, z, p_position.y);
+	}
+}
+
+bool EPASGroundCache::sample(PhysicsDirectSpaceState3D *p_dss, const Vector3 &p_position, Sample &r_sample) {
+	const int32_t x = Math::floor(p_position.x / cell_size);
+	const int32_t z = Math::floor(p_position.z / cell_size);
+	Cell &cell = _get_cell(x, z);
+	const bool owned = _matches(cell, x, z, p_position.y);
+	// Stale data is still good enough when we are out of budget, missing, dynamic or other level data is not.
+	if (!_is_fresh(cell, x, z, p_position.y) && (!owned || cell.dynamic || probes_this_frame < probe_budget)) {
+		_probe(p_dss, cell, x, z, p_position.y);
+	}
+	if (!cell.hit) {
+		return false;
+	}
+	r_sample.position = Vector3(p_position.x, cell.height, p_position.z);
+	r_sample.normal = cell.normal;
+	return true;
+}
+
+void EPASGroundCache::invalidate() {
+	for (int i = 0; i < GRID_SIZE * GRID_SIZE; i++) {
+		cells[i].valid = false;
+	}
+}
+
+void EPASGroundCache::set_collision_mask(uint32_t p_collision_mask) {
+	collision_mask = p_collision_mask;
+	invalidate();
+}
+
+void EPASGroundCache::set_cell_size(float p_cell_size) {
+	ERR_FAIL_COND(p_cell_size <= 0.0f);
+	cell_size = p_cell_size;
+	invalidate();
+}
+
+void EPASGroundCache::set_probe_budget(int p_probe_budget) {
+	probe_budget = p_probe_budget;
+}
+
+int EPASGroundCache::get_probes_this_frame() const {
+	return probes_this_frame;
+}
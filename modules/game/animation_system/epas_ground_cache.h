@@ -0,0 +1,103 @@
+/**************************************************************************/
+/*  epas_ground_cache.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                               SWANSONG                                 */
+/*                          https://eirteam.moe                           */
+/**************************************************************************/
+/* Copyright (c) 2023-present Álex Román Núñez (EIRTeam).                 */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef EPAS_GROUND_CACHE_H
+#define EPAS_GROUND_CACHE_H
+
+#include "core/math/vector3.h"
+#include "servers/physics_server_3d.h"
+
+// Caches ground heights around a character in a small world-aligned grid so foot IK can sample
+// them instead of raycasting every frame, cells are stored toroidally so moving around never
+// requires shifting the grid.
+// Cells are refreshed on a per-frame probe budget, ground belonging to non-static bodies (e.g.
+// moving platforms) is never cached and the whole cache is dropped on large motion (teleports).
+// Each cell remembers the height its probe started from and is only reused for queries starting
+// around that same height, so stacked geometry (overhangs, stairs over floors) never returns the
+// ground of another level.
+class EPASGroundCache {
+public:
+	struct Sample {
+		Vector3 position;
+		Vector3 normal;
+	};
+
+private:
+	static const int GRID_SIZE = 16;
+
+	struct Cell {
+		int32_t x = 0;
+		int32_t z = 0;
+		bool valid = false;
+		bool hit = false;
+		bool dynamic = false;
+		float height = 0.0f;
+		float probe_y = 0.0f;
+		Vector3 normal;
+		uint64_t refresh_frame = 0;
+	};
+
+	Cell cells[GRID_SIZE * GRID_SIZE];
+	uint64_t frame = 0;
+	int probes_this_frame = 0;
+	bool has_origin = false;
+	Vector3 origin;
+
+	float cell_size = 0.1f;
+	float probe_depth = 2.0f;
+	// How far from the height a cell was probed at a query can start and still reuse it.
+	float probe_height_tolerance = 0.25f;
+	uint32_t collision_mask = 0;
+	int probe_budget = 4;
+	uint64_t max_age_frames = 30;
+	float invalidation_distance = 1.0f;
+	float vertical_invalidation_distance = 0.5f;
+
+	Cell &_get_cell(int32_t p_x, int32_t p_z);
+	void _probe(PhysicsDirectSpaceState3D *p_dss, Cell &p_cell, int32_t p_x, int32_t p_z, float p_from_y);
+	bool _matches(const Cell &p_cell, int32_t p_x, int32_t p_z, float p_from_y) const;
+	bool _is_fresh(const Cell &p_cell, int32_t p_x, int32_t p_z, float p_from_y) const;
+
+public:
+	// Must be called once per frame before sampling, p_origin is the character's global position.
+	void begin_frame(const Vector3 &p_origin);
+	// Refreshes the cell under p_position if it is missing or stale and there's budget left,
+	// p_position.y should be the height later samples of that cell will start from.
+	void prefetch(PhysicsDirectSpaceState3D *p_dss, const Vector3 &p_position);
+	// Returns the first ground below p_position, only raycasts if there's no usable data in the cache.
+	bool sample(PhysicsDirectSpaceState3D *p_dss, const Vector3 &p_position, Sample &r_sample);
+	void invalidate();
+
+	void set_collision_mask(uint32_t p_collision_mask);
+	void set_cell_size(float p_cell_size);
+	void set_probe_budget(int p_probe_budget);
+	int get_probes_this_frame() const;
+};
+
+#endif // EPAS_GROUND_CACHE_H
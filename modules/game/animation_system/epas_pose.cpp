@@ -85,9 +85,9 @@ bool EPASPose::_set(const StringName &p_name, const Variant &p_value) {
 bool EPASPose::_get(const StringName &p_name, Variant &r_ret) const {
 	if (p_name == SNAME("pose_data")) {
 		Dictionary dic_out;
-		for (const KeyValue<StringName, BoneData *> &kv : bone_datas) {
+		// bone_datas_v keeps insertion order, which keeps saved poses stable.
+		for (BoneData *bone_data : bone_datas_v) {
 			Dictionary bone_data_dic;
-			BoneData *bone_data = kv.value;
 			if (bone_data->has_position) {
 				bone_data_dic["position"] = bone_data->position;
 			}
@@ -109,7 +109,7 @@ bool EPASPose::_get(const StringName &p_name, Variant &r_ret) const {
 }
 
 void EPASPose::clear() {
-	for (KeyValue<StringName, BoneData *> kv : bone_datas) {
+	for (const KeyValue<StringName, BoneData *> &kv : bone_datas) {
 		memdelete(kv.value);
 	}
 	bone_datas_v.clear();
@@ -125,7 +125,7 @@ EPASPose::BoneData *EPASPose::get_bone_data(const StringName &p_bone_name) const
 	return pp != nullptr ? *pp : nullptr;
 }
 
-const HashMap<StringName, EPASPose::BoneData *> EPASPose::get_bone_map() const {
+const FlatHashMap<StringName, EPASPose::BoneData *> EPASPose::get_bone_map() const {
 	return bone_datas;
 }
 
@@ -34,6 +34,7 @@
 #include "core/math/transform_3d.h"
 #include "core/math/vector3.h"
 #include "core/string/ustring.h"
+#include "core/templates/flat_hash_map.h"
 #include "scene/3d/skeleton_3d.h"
 #include "scene/resources/animation.h"
 
@@ -107,11 +108,11 @@ public:
 	};
 
 private:
-	HashMap<StringName, BoneData *> bone_datas;
+	FlatHashMap<StringName, BoneData *> bone_datas;
 	// This vector is used so we can access bone datas by index
 	Vector<BoneData *> bone_datas_v;
 	BoneData *get_bone_data(const StringName &p_bone_name) const;
-	const HashMap<StringName, BoneData *> get_bone_map() const;
+	const FlatHashMap<StringName, BoneData *> get_bone_map() const;
 
 public:
 	int get_bone_count() const;
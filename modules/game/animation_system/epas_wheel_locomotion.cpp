@@ -100,6 +100,19 @@ void EPASWheelLocomotion::process_node(const Ref<EPASPose> &p_base_pose, Ref<EPA
 		foot_ik_init = true;
 	}
 
+	if (use_foot_ik && foot_ik_init && use_foot_ik_ground_cache) {
+		PhysicsDirectSpaceState3D *dss = get_skeleton()->get_world_3d()->get_direct_space_state();
+		const Vector3 skel_position = get_skeleton()->get_global_position();
+		ground_cache.begin_frame(skel_position);
+		// Warm up the cells our feet are heading to, so sampling them later doesn't need to raycast.
+		// Probes must start at the same height the IK rays will, otherwise they would be useless.
+		for (int i = 0; i < 2 && ground_cache_query_height > 0.0f; i++) {
+			Vector3 prefetch_position = foot_ik[i].out_ik_transform.origin + linear_velocity * ground_cache_lookahead;
+			prefetch_position.y = skel_position.y + ground_cache_query_height;
+			ground_cache.prefetch(dss, prefetch_position);
+		}
+	}
+
 	// Janky-ass bsearch to find where we are at right now.
 	LocomotionSet set;
 	set.x_pos = x_blend;
@@ -166,13 +179,6 @@ void EPASWheelLocomotion::process_node(const Ref<EPASPose> &p_base_pose, Ref<EPA
 		// We sample both locomotion sets
 		first_set->interpolate(first_set_cycle_time, p_base_pose, p_target_pose, foot_ik_grounded);
 		second_set->interpolate(second_set_cycle_time, p_base_pose, second_pose, foot_ik_grounded_second);
-		Transform3D pre_blend_ankle_trfs[2];
-
-		if (use_foot_ik) {
-			for (int i = 0; i < 2; i++) {
-				pre_blend_ankle_trfs[i] = p_target_pose->calculate_bone_global_transform(foot_ik[i].bone_name, get_skeleton(), p_base_pose);
-			}
-		}
 
 		// Then we blend them together based on x
 
@@ -311,43 +317,74 @@ Ref<EPASIKNode> EPASWheelLocomotion::_get_foot_ik_node(uint32_t p_idx) const {
 	return node;
 }
 
-void EPASWheelLocomotion::_ik_process_foot(LocomotionSet *p_loc_set, float p_foot_ik_grounded[2], Transform3D p_ankle_ik_targets[2], Transform3D p_ankle_pinned_ik_targets[2], const Ref<EPASPose> &p_base_pose, Ref<EPASPose> p_target_pose) {
+bool EPASWheelLocomotion::_find_ground(PhysicsDirectSpaceState3D *p_dss, const Vector3 &p_from, const Vector3 &p_to, Vector3 &r_position, Vector3 &r_normal) {
+	if (use_foot_ik_ground_cache) {
+		EPASGroundCache::Sample sample;
+		if (!ground_cache.sample(p_dss, p_from, sample)) {
+			return false;
+		}
+		// Behave like a vertical ray from p_from to p_to would.
+		if (sample.position.y > p_from.y || sample.position.y < p_to.y) {
+			return false;
+		}
+		r_position = sample.position;
+		r_normal = sample.normal;
+		return true;
+	}
+
+	PhysicsDirectSpaceState3D::RayParameters params;
+	params.collision_mask = HBPhysicsLayers::LAYER_WORLD_GEO;
+	params.from = p_from;
+	params.to = p_to;
+	PhysicsDirectSpaceState3D::RayResult result;
+	if (!p_dss->intersect_ray(params, result)) {
+		return false;
+	}
+	r_position = result.position;
+	r_normal = result.normal;
+	return true;
+}
+
+void EPASWheelLocomotion::_ik_process_foot(LocomotionSet *p_loc_set, float p_foot_ik_grounded[2], Transform3D p_ankle_ik_targets[2], Transform3D p_ankle_pinned_ik_targets[2], Transform3D p_ankle_global_trfs[2], const Ref<EPASPose> &p_base_pose, Ref<EPASPose> p_target_pose) {
+	Skeleton3D *skel = get_skeleton();
+	const Transform3D skel_global_trf = skel->get_global_transform();
+	float ankle_heights[2];
+	for (int i = 0; i < 2; i++) {
+		Transform3D ankle_trf = p_target_pose->calculate_bone_global_transform(foot_ik[i].bone_name, skel, p_base_pose);
+		ankle_heights[i] = ankle_trf.origin.y;
+		p_ankle_global_trfs[i] = skel_global_trf * ankle_trf;
+	}
+
 	if (!use_foot_ik || !foot_ik_init) {
 		return;
 	}
-	Skeleton3D *skel = get_skeleton();
 	PhysicsDirectSpaceState3D *dss = skel->get_world_3d()->get_direct_space_state();
+	Transform3D hip_trf = p_target_pose->calculate_bone_global_transform(hip_bone_name, skel, p_base_pose);
+	Transform3D hip_global_trf = skel_global_trf * hip_trf;
+	ground_cache_query_height = hip_global_trf.origin.y - skel_global_trf.origin.y;
 	for (int i = 0; i < 2; i++) {
 		StringName ankle_bone_name = foot_ik[i].bone_name;
-		Transform3D ankle_global_trf = p_target_pose->calculate_bone_global_transform(ankle_bone_name, skel, p_base_pose);
-		ankle_global_trf = skel->get_global_transform() * ankle_global_trf;
+		const Transform3D &ankle_global_trf = p_ankle_global_trfs[i];
+		float ankle_height = ankle_heights[i];
 
-		PhysicsDirectSpaceState3D::RayResult result;
-
-		Transform3D hip_trf = p_target_pose->calculate_bone_global_transform(hip_bone_name, skel, p_base_pose);
-		Transform3D hip_global_trf = skel->get_global_transform() * hip_trf;
-		float ankle_height = p_target_pose->calculate_bone_global_transform(ankle_bone_name, skel, p_base_pose).origin.y;
-
-		PhysicsDirectSpaceState3D::RayParameters params;
-		params.collision_mask = HBPhysicsLayers::LAYER_WORLD_GEO;
-
-		params.from = ankle_global_trf.origin;
-		params.from.y = hip_global_trf.origin.y;
-		params.to = ankle_global_trf.origin;
+		Vector3 from = ankle_global_trf.origin;
+		from.y = hip_global_trf.origin.y;
+		Vector3 to = ankle_global_trf.origin;
+		Vector3 ground_position;
+		Vector3 ground_normal;
 
 		p_ankle_ik_targets[i] = ankle_global_trf;
 		// This ensures the ankle is always above the ground
-		if (dss->intersect_ray(params, result)) {
-			p_ankle_ik_targets[i].origin.y = MAX(p_ankle_ik_targets[i].origin.y, result.position.y + ankle_height);
+		if (_find_ground(dss, from, to, ground_position, ground_normal)) {
+			p_ankle_ik_targets[i].origin.y = MAX(p_ankle_ik_targets[i].origin.y, ground_position.y + ankle_height);
 		}
 
-		params.to.y = hip_global_trf.origin.y - hip_trf.origin.y - 0.5f;
+		to.y = hip_global_trf.origin.y - hip_trf.origin.y - 0.5f;
 
 		// Intersect to current ankle location
 		p_ankle_pinned_ik_targets[i] = ankle_global_trf;
-		if (dss->intersect_ray(params, result)) {
-			result.position += result.normal * ankle_height;
-			p_ankle_pinned_ik_targets[i].origin = result.position;
+		if (_find_ground(dss, from, to, ground_position, ground_normal)) {
+			p_ankle_pinned_ik_targets[i].origin = ground_position + ground_normal * ankle_height;
 		} else {
 			continue;
 		}
@@ -372,11 +409,11 @@ void EPASWheelLocomotion::_ik_process_foot(LocomotionSet *p_loc_set, float p_foo
 		}
 
 		float dist_to_ankle = ankle_to_toe.length();
-		params.from += model_global_forward * dist_to_ankle;
-		params.to += model_global_forward * dist_to_ankle;
+		from += model_global_forward * dist_to_ankle;
+		to += model_global_forward * dist_to_ankle;
 
-		if (dss->intersect_ray(params, result)) {
-			Quaternion new_rot = Quaternion(Vector3(0.0f, 1.0f, 0.0f), result.normal) * p_ankle_pinned_ik_targets[i].basis;
+		if (_find_ground(dss, from, to, ground_position, ground_normal)) {
+			Quaternion new_rot = Quaternion(Vector3(0.0f, 1.0f, 0.0f), ground_normal) * p_ankle_pinned_ik_targets[i].basis;
 			p_ankle_pinned_ik_targets[i].basis = new_rot;
 		}
 	}
@@ -418,11 +455,13 @@ void EPASWheelLocomotion::_ik_process(LocomotionSet *p_loc_sets[2], float p_foot
 	Transform3D ankle_global_ik_targets_second[2];
 	Transform3D ankle_global_ik_pinned_targets[2];
 	Transform3D ankle_global_ik_pinned_targets_second[2];
+	Transform3D original_ankles_first[2];
+	Transform3D original_ankles_second[2];
 	debug_geo->clear();
 	test_flag = true;
-	_ik_process_foot(p_loc_sets[0], p_foot_ik_grounded[0], ankle_global_ik_targets, ankle_global_ik_pinned_targets, p_base_pose, p_target_pose);
+	_ik_process_foot(p_loc_sets[0], p_foot_ik_grounded[0], ankle_global_ik_targets, ankle_global_ik_pinned_targets, original_ankles_first, p_base_pose, p_target_pose);
 	test_flag = false;
-	_ik_process_foot(p_loc_sets[0], p_foot_ik_grounded[1], ankle_global_ik_targets_second, ankle_global_ik_pinned_targets_second, p_base_pose, p_second_pose);
+	_ik_process_foot(p_loc_sets[0], p_foot_ik_grounded[1], ankle_global_ik_targets_second, ankle_global_ik_pinned_targets_second, original_ankles_second, p_base_pose, p_second_pose);
 
 	float hip_offset_targets[2] = { 0.0f };
 
@@ -435,8 +474,8 @@ void EPASWheelLocomotion::_ik_process(LocomotionSet *p_loc_sets[2], float p_foot
 		Ref<EPASIKNode> ik_node = _get_foot_ik_node(i);
 		ik_node->set_target_transform(foot_ik[i].out_ik_transform);
 
-		Transform3D first_original_ankle = get_skeleton()->get_global_transform() * p_target_pose->calculate_bone_global_transform(foot_ik[i].bone_name, get_skeleton(), p_base_pose);
-		Transform3D second_original_ankle = get_skeleton()->get_global_transform() * p_second_pose->calculate_bone_global_transform(foot_ik[i].bone_name, get_skeleton(), p_base_pose);
+		const Transform3D &first_original_ankle = original_ankles_first[i];
+		const Transform3D &second_original_ankle = original_ankles_second[i];
 
 		Vector3 pole_position_first;
 		Vector3 pole_position_second;
@@ -581,6 +620,15 @@ void EPASWheelLocomotion::set_use_foot_ik(bool p_use_foot_ik) {
 	use_foot_ik = p_use_foot_ik;
 }
 
+bool EPASWheelLocomotion::get_use_foot_ik_ground_cache() const {
+	return use_foot_ik_ground_cache;
+}
+
+void EPASWheelLocomotion::set_use_foot_ik_ground_cache(bool p_use_foot_ik_ground_cache) {
+	use_foot_ik_ground_cache = p_use_foot_ik_ground_cache;
+	ground_cache.invalidate();
+}
+
 void EPASWheelLocomotion::set_left_foot_ik_node(Ref<EPASIKNode> p_ik_left_foot_ik_node) {
 	foot_ik[0].ik_node = p_ik_left_foot_ik_node.ptr();
 }
@@ -633,6 +681,8 @@ void EPASWheelLocomotion::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_right_foot_bone_name"), &EPASWheelLocomotion::get_right_foot_bone_name);
 	ClassDB::bind_method(D_METHOD("set_use_foot_ik", "use_foot_ik"), &EPASWheelLocomotion::set_use_foot_ik);
 	ClassDB::bind_method(D_METHOD("get_use_foot_ik"), &EPASWheelLocomotion::get_use_foot_ik);
+	ClassDB::bind_method(D_METHOD("set_use_foot_ik_ground_cache", "use_foot_ik_ground_cache"), &EPASWheelLocomotion::set_use_foot_ik_ground_cache);
+	ClassDB::bind_method(D_METHOD("get_use_foot_ik_ground_cache"), &EPASWheelLocomotion::get_use_foot_ik_ground_cache);
 	ClassDB::bind_method(D_METHOD("set_hip_bone_name", "hip_bone_name"), &EPASWheelLocomotion::set_hip_bone_name);
 	ClassDB::bind_method(D_METHOD("get_hip_bone_name"), &EPASWheelLocomotion::get_hip_bone_name);
 	ClassDB::bind_method(D_METHOD("set_right_foot_ik_node", "right_foot_ik_node"), &EPASWheelLocomotion::set_right_foot_ik_node);
@@ -643,6 +693,7 @@ void EPASWheelLocomotion::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::STRING_NAME, "right_foot_bone_name"), "set_right_foot_bone_name", "get_right_foot_bone_name");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING_NAME, "hip_bone_name"), "set_hip_bone_name", "get_hip_bone_name");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_foot_ik"), "set_use_foot_ik", "get_use_foot_ik");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_foot_ik_ground_cache"), "set_use_foot_ik_ground_cache", "get_use_foot_ik_ground_cache");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "x_blend", PROPERTY_HINT_RANGE, "0,1,0.01"), "set_x_blend", "get_x_blend");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING_NAME, "root_bone_name"), "set_root_bone_name", "get_root_bone_name");
 
@@ -697,6 +748,7 @@ void EPASWheelLocomotion::reset_foot_ik() {
 EPASWheelLocomotion::EPASWheelLocomotion() {
 	locomotion_sets = Vector<LocomotionSet *>();
 	sorted_locomotion_sets = Vector<LocomotionSet *>();
+	ground_cache.set_collision_mask(HBPhysicsLayers::LAYER_WORLD_GEO);
 }
 
 #ifdef DEBUG_ENABLED
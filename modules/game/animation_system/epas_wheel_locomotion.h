@@ -34,6 +34,7 @@
 #include "../fabrik/fabrik.h"
 #include "../inertialization.h"
 #include "epas_animation.h"
+#include "epas_ground_cache.h"
 #include "epas_ik_node.h"
 #include "epas_node.h"
 #include "epas_pose.h"
@@ -146,7 +147,15 @@ private:
 	bool foot_ik_init = false;
 	float max_velocity = 2.8f;
 
-	void _ik_process_foot(LocomotionSet *p_loc_set, float p_foot_ik_grounded[2], Transform3D p_ankle_ik_targets[2], Transform3D p_ankle_pinned_ik_targets[2], const Ref<EPASPose> &p_base_pose, Ref<EPASPose> p_target_pose);
+	EPASGroundCache ground_cache;
+	bool use_foot_ik_ground_cache = false;
+	// How far ahead (in seconds) we prefetch the ground under each foot.
+	float ground_cache_lookahead = 0.2f;
+	// Height above the skeleton the foot IK rays start from, taken from the last IK pass.
+	float ground_cache_query_height = 0.0f;
+
+	bool _find_ground(PhysicsDirectSpaceState3D *p_dss, const Vector3 &p_from, const Vector3 &p_to, Vector3 &r_position, Vector3 &r_normal);
+	void _ik_process_foot(LocomotionSet *p_loc_set, float p_foot_ik_grounded[2], Transform3D p_ankle_ik_targets[2], Transform3D p_ankle_pinned_ik_targets[2], Transform3D p_ankle_global_trfs[2], const Ref<EPASPose> &p_base_pose, Ref<EPASPose> p_target_pose);
 	void _ik_process(LocomotionSet *p_loc_sets[2], float p_foot_ik_grounded[2][2], Ref<EPASPose> p_target_pose, Ref<EPASPose> p_second_pose, Ref<EPASPose> p_base_pose, float p_x, float p_delta);
 	float find_next_feet_ground_time(Ref<EPASAnimation> p_anim, float p_times[2]) const;
 	bool process_events(LocomotionSet *p_sets[2], float p_time, float p_blend, float p_previous_time, bool p_out_prev_lock_state[2], bool p_out_lock_state[2], float p_out_prev_lock_amount[2], float p_out_lock_amount[2]);
@@ -183,6 +192,8 @@ public:
 	void set_right_foot_bone_name(const StringName &p_right_foot_bone_name);
 	bool get_use_foot_ik() const;
 	void set_use_foot_ik(bool p_use_foot_ik);
+	bool get_use_foot_ik_ground_cache() const;
+	void set_use_foot_ik_ground_cache(bool p_use_foot_ik_ground_cache);
 
 	void set_left_foot_ik_node(Ref<EPASIKNode> p_ik_left_foot_ik_node);
 
@@ -255,10 +255,9 @@ Vector3 FABRIKSolver::get_joint_hinge_axis(int p_joint_idx) const {
 	return joints[p_joint_idx].hinge_axis;
 }
 
-void FABRIKSolver::solve(int p_iterations) {
-	ZoneScopedN("FABRIK Solve");
+bool FABRIKSolver::_begin_solve() {
 	if (joints.size() == 0) {
-		return;
+		return false;
 	}
 
 	float dist_eps_squared = DIST_EPS * DIST_EPS;
@@ -274,7 +273,7 @@ void FABRIKSolver::solve(int p_iterations) {
 	}
 
 	if (joints[joints.size() - 1].working_position.distance_squared_to(target_position) < dist_eps_squared) {
-		return;
+		return false;
 	}
 
 	Vector3 base_pos = joints[0].working_position;
@@ -286,9 +285,20 @@ void FABRIKSolver::solve(int p_iterations) {
 			joints.write[i].working_position = parent_position + parent_position.direction_to(target_position) * joints[i].distance_to_parent;
 		}
 		_apply_fabrik();
+		return false;
+	}
+	return true;
+}
+
+void FABRIKSolver::solve(int p_iterations) {
+	ZoneScopedN("FABRIK Solve");
+	if (!_begin_solve()) {
 		return;
 	}
 
+	float dist_eps_squared = DIST_EPS * DIST_EPS;
+	Vector3 base_pos = joints[0].working_position;
+
 	for (int i = 0; i < p_iterations; i++) {
 		if (joints[joints.size() - 1].working_position.distance_squared_to(target_position) < dist_eps_squared) {
 			_apply_fabrik();
@@ -333,3 +343,240 @@ Vector3 FABRIKSolver::get_target_position() const {
 void FABRIKSolver::set_target_position(const Vector3 &p_target_position) {
 	target_position = p_target_position;
 }
+
+FABRIKBatchSolver::ChainGroup &FABRIKBatchSolver::_get_group(int p_joint_count) {
+	for (ChainGroup &group : groups) {
+		if (group.joint_count == p_joint_count) {
+			return group;
+		}
+	}
+	groups.push_back(ChainGroup());
+	ChainGroup &group = groups[groups.size() - 1];
+	group.joint_count = p_joint_count;
+	return group;
+}
+
+void FABRIKBatchSolver::add_solver(FABRIKSolver *p_solver) {
+	ERR_FAIL_NULL(p_solver);
+	if (p_solver->joints.size() == 0) {
+		return;
+	}
+	ChainGroup &group = _get_group(p_solver->joints.size());
+	group.solvers.push_back(p_solver);
+}
+
+void FABRIKBatchSolver::clear() {
+	// Keep the groups around so their buffers can be reused next time.
+	for (ChainGroup &group : groups) {
+		group.solvers.clear();
+		group.chain_count = 0;
+	}
+}
+
+void FABRIKBatchSolver::_gather(ChainGroup &p_group) {
+	// Chains that are already solved or fully extended are done by _begin_solve, compact them out.
+	uint32_t write_idx = 0;
+	for (uint32_t i = 0; i < p_group.solvers.size(); i++) {
+		if (p_group.solvers[i]->_begin_solve()) {
+			p_group.solvers[write_idx++] = p_group.solvers[i];
+		}
+	}
+	p_group.solvers.resize(write_idx);
+
+	const int chain_count = p_group.solvers.size();
+	const int joint_count = p_group.joint_count;
+	p_group.chain_count = chain_count;
+
+	const uint32_t joint_data_size = chain_count * joint_count;
+	p_group.position_x.resize(joint_data_size);
+	p_group.position_y.resize(joint_data_size);
+	p_group.position_z.resize(joint_data_size);
+	p_group.distances.resize(joint_data_size);
+	p_group.target_x.resize(chain_count);
+	p_group.target_y.resize(chain_count);
+	p_group.target_z.resize(chain_count);
+	p_group.base_x.resize(chain_count);
+	p_group.base_y.resize(chain_count);
+	p_group.base_z.resize(chain_count);
+	p_group.active.resize(chain_count);
+
+	for (int c = 0; c < chain_count; c++) {
+		const FABRIKSolver *solver = p_group.solvers[c];
+		for (int j = 0; j < joint_count; j++) {
+			const FABRIKSolver::FABRIKJoint &joint = solver->joints[j];
+			const int idx = j * chain_count + c;
+			p_group.position_x[idx] = joint.working_position.x;
+			p_group.position_y[idx] = joint.working_position.y;
+			p_group.position_z[idx] = joint.working_position.z;
+			p_group.distances[idx] = joint.distance_to_parent;
+		}
+		p_group.target_x[c] = solver->target_position.x;
+		p_group.target_y[c] = solver->target_position.y;
+		p_group.target_z[c] = solver->target_position.z;
+		p_group.base_x[c] = p_group.position_x[c];
+		p_group.base_y[c] = p_group.position_y[c];
+		p_group.base_z[c] = p_group.position_z[c];
+		p_group.active[c] = 1.0f;
+	}
+}
+
+int FABRIKBatchSolver::_update_active(ChainGroup &p_group) {
+	const int chain_count = p_group.chain_count;
+	const int end_offset = (p_group.joint_count - 1) * chain_count;
+	const float tolerance_squared = tolerance * tolerance;
+	const float *px = p_group.position_x.ptr() + end_offset;
+	const float *py = p_group.position_y.ptr() + end_offset;
+	const float *pz = p_group.position_z.ptr() + end_offset;
+	float *active = p_group.active.ptr();
+	int active_count = 0;
+	for (int c = 0; c < chain_count; c++) {
+		const float dx = px[c] - p_group.target_x[c];
+		const float dy = py[c] - p_group.target_y[c];
+		const float dz = pz[c] - p_group.target_z[c];
+		// Once a chain converges it stays frozen for the remaining iterations.
+		active[c] = (dx * dx + dy * dy + dz * dz) < tolerance_squared ? 0.0f : active[c];
+		active_count += active[c] != 0.0f;
+	}
+	return active_count;
+}
+
+void FABRIKBatchSolver::_solve_backwards(ChainGroup &p_group) {
+	const int chain_count = p_group.chain_count;
+	float *px = p_group.position_x.ptr();
+	float *py = p_group.position_y.ptr();
+	float *pz = p_group.position_z.ptr();
+	const float *active = p_group.active.ptr();
+
+	const int end_offset = (p_group.joint_count - 1) * chain_count;
+	for (int c = 0; c < chain_count; c++) {
+		const float a = active[c];
+		px[end_offset + c] += (p_group.target_x[c] - px[end_offset + c]) * a;
+		py[end_offset + c] += (p_group.target_y[c] - py[end_offset + c]) * a;
+		pz[end_offset + c] += (p_group.target_z[c] - pz[end_offset + c]) * a;
+	}
+
+	for (int j = p_group.joint_count - 2; j >= 0; j--) {
+		float *x = px + j * chain_count;
+		float *y = py + j * chain_count;
+		float *z = pz + j * chain_count;
+		const float *child_x = px + (j + 1) * chain_count;
+		const float *child_y = py + (j + 1) * chain_count;
+		const float *child_z = pz + (j + 1) * chain_count;
+		const float *distance = p_group.distances.ptr() + (j + 1) * chain_count;
+		for (int c = 0; c < chain_count; c++) {
+			const float dx = x[c] - child_x[c];
+			const float dy = y[c] - child_y[c];
+			const float dz = z[c] - child_z[c];
+			const float length = Math::sqrt(dx * dx + dy * dy + dz * dz);
+			const float scale = length > 0.0f ? distance[c] / length : 0.0f;
+			const float a = active[c];
+			x[c] += (child_x[c] + dx * scale - x[c]) * a;
+			y[c] += (child_y[c] + dy * scale - y[c]) * a;
+			z[c] += (child_z[c] + dz * scale - z[c]) * a;
+		}
+	}
+}
+
+void FABRIKBatchSolver::_solve_forwards(ChainGroup &p_group) {
+	const int chain_count = p_group.chain_count;
+	float *px = p_group.position_x.ptr();
+	float *py = p_group.position_y.ptr();
+	float *pz = p_group.position_z.ptr();
+	const float *active = p_group.active.ptr();
+
+	for (int c = 0; c < chain_count; c++) {
+		const float a = active[c];
+		px[c] += (p_group.base_x[c] - px[c]) * a;
+		py[c] += (p_group.base_y[c] - py[c]) * a;
+		pz[c] += (p_group.base_z[c] - pz[c]) * a;
+	}
+
+	for (int j = 1; j < p_group.joint_count; j++) {
+		float *x = px + j * chain_count;
+		float *y = py + j * chain_count;
+		float *z = pz + j * chain_count;
+		const float *parent_x = px + (j - 1) * chain_count;
+		const float *parent_y = py + (j - 1) * chain_count;
+		const float *parent_z = pz + (j - 1) * chain_count;
+		const float *distance = p_group.distances.ptr() + j * chain_count;
+		for (int c = 0; c < chain_count; c++) {
+			const float dx = x[c] - parent_x[c];
+			const float dy = y[c] - parent_y[c];
+			const float dz = z[c] - parent_z[c];
+			const float length = Math::sqrt(dx * dx + dy * dy + dz * dz);
+			const float scale = length > 0.0f ? distance[c] / length : 0.0f;
+			const float a = active[c];
+			x[c] += (parent_x[c] + dx * scale - x[c]) * a;
+			y[c] += (parent_y[c] + dy * scale - y[c]) * a;
+			z[c] += (parent_z[c] + dz * scale - z[c]) * a;
+		}
+	}
+}
+
+void FABRIKBatchSolver::_apply_constraints(ChainGroup &p_group) {
+	// Joint rotations depend on the ones from the previous iteration, so they have to be resolved
+	// every iteration like FABRIKSolver::solve does or hinged chains would end up in a different pose.
+	const int chain_count = p_group.chain_count;
+	for (int c = 0; c < chain_count; c++) {
+		if (p_group.active[c] == 0.0f) {
+			continue;
+		}
+		FABRIKSolver *solver = p_group.solvers[c];
+		for (int j = 0; j < p_group.joint_count; j++) {
+			const int idx = j * chain_count + c;
+			solver->joints.write[j].working_position = Vector3(p_group.position_x[idx], p_group.position_y[idx], p_group.position_z[idx]);
+		}
+		solver->_apply_fabrik();
+		solver->_local_to_global();
+	}
+}
+
+void FABRIKBatchSolver::_scatter(ChainGroup &p_group) {
+	const int chain_count = p_group.chain_count;
+	for (int c = 0; c < chain_count; c++) {
+		FABRIKSolver *solver = p_group.solvers[c];
+		for (int j = 0; j < p_group.joint_count; j++) {
+			const int idx = j * chain_count + c;
+			solver->joints.write[j].working_position = Vector3(p_group.position_x[idx], p_group.position_y[idx], p_group.position_z[idx]);
+		}
+		solver->_apply_fabrik();
+	}
+}
+
+void FABRIKBatchSolver::solve(int p_max_iterations) {
+	ZoneScopedN("FABRIK Batch Solve");
+	last_iteration_count = 0;
+	for (ChainGroup &group : groups) {
+		if (group.solvers.is_empty()) {
+			continue;
+		}
+		_gather(group);
+		if (group.chain_count == 0) {
+			continue;
+		}
+		int iteration = 0;
+		for (; iteration < p_max_iterations; iteration++) {
+			if (_update_active(group) == 0) {
+				break;
+			}
+			_solve_backwards(group);
+			_solve_forwards(group);
+			_apply_constraints(group);
+		}
+		last_iteration_count = MAX(last_iteration_count, iteration);
+		_scatter(group);
+	}
+	clear();
+}
+
+void FABRIKBatchSolver::set_tolerance(float p_tolerance) {
+	tolerance = p_tolerance;
+}
+
+float FABRIKBatchSolver::get_tolerance() const {
+	return tolerance;
+}
+
+int FABRIKBatchSolver::get_last_iteration_count() const {
+	return last_iteration_count;
+}
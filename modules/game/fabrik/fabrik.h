@@ -31,10 +31,12 @@
 #define FABRIK_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 #include "scene/resources/immediate_mesh.h"
 
 class FABRIKSolver : public RefCounted {
 	GDCLASS(FABRIKSolver, RefCounted);
+	friend class FABRIKBatchSolver;
 
 	const float DIST_EPS = 0.0001f;
 
@@ -65,6 +67,8 @@ class FABRIKSolver : public RefCounted {
 	void _process_pole_vector();
 	void _local_to_global();
 	void _apply_fabrik();
+	// Sets up the working positions, returns false if the chain was already solved without iterating.
+	bool _begin_solve();
 
 protected:
 	static void _bind_methods();
@@ -117,4 +121,52 @@ public:
 	}
 };
 
+// Solves many FABRIK chains together (e.g. every limb of every agent), giving the same results as
+// FABRIKSolver::solve. Joint positions are stored as structure of arrays grouped by joint count, so
+// the positional passes run across chains and can be vectorized, the rotation and hinge constraints
+// are still applied to each chain on every iteration. Chains stop iterating once their end is within
+// tolerance.
+class FABRIKBatchSolver {
+	struct ChainGroup {
+		int joint_count = 0;
+		int chain_count = 0;
+		LocalVector<FABRIKSolver *> solvers;
+		// Per joint data is indexed as [joint_idx * chain_count + chain_idx].
+		LocalVector<float> position_x;
+		LocalVector<float> position_y;
+		LocalVector<float> position_z;
+		LocalVector<float> distances;
+		// Per chain data.
+		LocalVector<float> target_x;
+		LocalVector<float> target_y;
+		LocalVector<float> target_z;
+		LocalVector<float> base_x;
+		LocalVector<float> base_y;
+		LocalVector<float> base_z;
+		LocalVector<float> active;
+	};
+
+	LocalVector<ChainGroup> groups;
+	float tolerance = 0.0001f;
+	int last_iteration_count = 0;
+
+	ChainGroup &_get_group(int p_joint_count);
+	void _gather(ChainGroup &p_group);
+	int _update_active(ChainGroup &p_group);
+	void _solve_backwards(ChainGroup &p_group);
+	void _solve_forwards(ChainGroup &p_group);
+	void _apply_constraints(ChainGroup &p_group);
+	void _scatter(ChainGroup &p_group);
+
+public:
+	// Solvers are borrowed until solve() is called, they must stay alive until then.
+	void add_solver(FABRIKSolver *p_solver);
+	void clear();
+	void solve(int p_max_iterations = 10);
+
+	void set_tolerance(float p_tolerance);
+	float get_tolerance() const;
+	int get_last_iteration_count() const;
+};
+
 #endif // FABRIK_H
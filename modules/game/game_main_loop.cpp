@@ -29,6 +29,7 @@
 
 #include "game_main_loop.h"
 
+#include "core/os/frame_arena.h"
 #include "game/console.h"
 #include "imgui/register_types.h"
 
@@ -91,6 +92,7 @@ void HBGameMainLoop::change_scene(Node *p_new_scene) {
 
 bool HBGameMainLoop::process(double p_time) {
 	ZoneScopedN("Process Frame");
+	TracyPlot("Frame Arena High-Water Mark", int64_t(FrameArena::get_high_water_mark()));
 	bool result = SceneTree::process(p_time);
 	if (Steamworks::get_singleton()->get_input()) {
 		Steamworks::get_singleton()->get_input()->run_frame();
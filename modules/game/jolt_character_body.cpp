@@ -77,11 +77,42 @@ void JoltCharacterBody3D::_notification(int p_what) {
 			character = new JPH::CharacterVirtual(settings, pos, JPH::Quat::sIdentity(), &ps);
 			character->SetListener(this);
 		} break;
+		case NOTIFICATION_ENTER_TREE: {
+			previous_physics_transform = get_global_transform();
+			if (!Engine::get_singleton()->is_editor_hint()) {
+				get_tree()->connect(SNAME("physics_frame"), callable_mp(this, &JoltCharacterBody3D::_on_physics_frame));
+			}
+		} break;
+		case NOTIFICATION_EXIT_TREE: {
+			if (!Engine::get_singleton()->is_editor_hint()) {
+				get_tree()->disconnect(SNAME("physics_frame"), callable_mp(this, &JoltCharacterBody3D::_on_physics_frame));
+			}
+		} break;
+		case NOTIFICATION_RESET_PHYSICS_INTERPOLATION: {
+			previous_physics_transform = get_global_transform();
+		} break;
 		case NOTIFICATION_PHYSICS_PROCESS: {
 		} break;
 	}
 }
 
+void JoltCharacterBody3D::_on_physics_frame() {
+	_physics_frame_started();
+}
+
+void JoltCharacterBody3D::_physics_frame_started() {
+	previous_physics_transform = get_global_transform();
+}
+
+Transform3D JoltCharacterBody3D::get_interpolated_global_transform() const {
+	// The body itself only moves at physics rate, anything visual that follows it should use this instead
+	if (!is_physics_interpolated_and_enabled()) {
+		return get_global_transform();
+	}
+	const real_t fraction = Engine::get_singleton()->get_physics_interpolation_fraction();
+	return previous_physics_transform.interpolate_with(get_global_transform(), fraction);
+}
+
 void JoltCharacterBody3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_velocity"), &JoltCharacterBody3D::get_velocity);
 	ClassDB::bind_method(D_METHOD("set_velocity", "velocity"), &JoltCharacterBody3D::set_velocity);
@@ -90,6 +121,7 @@ void JoltCharacterBody3D::_bind_methods() {
 	GDVIRTUAL_BIND(_post_physics_process, "delta");
 	ClassDB::bind_method(D_METHOD("get_desired_velocity"), &JoltCharacterBody3D::get_desired_velocity);
 	ClassDB::bind_method(D_METHOD("get_ground_velocity"), &JoltCharacterBody3D::get_ground_velocity);
+	ClassDB::bind_method(D_METHOD("get_interpolated_global_transform"), &JoltCharacterBody3D::get_interpolated_global_transform);
 }
 
 void JoltCharacterBody3D::OnContactSolve(const JPH::CharacterVirtual *inCharacter, const JPH::BodyID &inBodyID2, const JPH::SubShapeID &inSubShapeID2, JPH::RVec3Arg inContactPosition, JPH::Vec3Arg inContactNormal, JPH::Vec3Arg inContactVelocity, const JPH::PhysicsMaterial *inContactMaterial, JPH::Vec3Arg inCharacterVelocity, JPH::Vec3 &ioNewCharacterVelocity) {
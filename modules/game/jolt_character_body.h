@@ -51,11 +51,17 @@ class JoltCharacterBody3D : public PhysicsBody3D, public JPH::CharacterContactLi
 	JPH::Ref<JPH::CharacterVirtual> character;
 	JPH::TempAllocator *temp_allocator;
 
+	// Transform at the start of the latest physics tick, used to interpolate between ticks
+	Transform3D previous_physics_transform;
+
 	JPH::Ref<JPH::CharacterVirtualSettings> get_settings() const;
+	void _on_physics_frame();
 
 protected:
 	void _notification(int p_what);
 	static void _bind_methods();
+	// Called at the start of every physics tick, before any node is processed
+	virtual void _physics_frame_started();
 	GDVIRTUAL1(_post_physics_process, double)
 	virtual void OnContactSolve(const JPH::CharacterVirtual *inCharacter, const JPH::BodyID &inBodyID2, const JPH::SubShapeID &inSubShapeID2, JPH::RVec3Arg inContactPosition, JPH::Vec3Arg inContactNormal, JPH::Vec3Arg inContactVelocity, const JPH::PhysicsMaterial *inContactMaterial, JPH::Vec3Arg inCharacterVelocity, JPH::Vec3 &ioNewCharacterVelocity) override;
 
@@ -71,6 +77,7 @@ public:
 	JPH::CharacterVirtual::EGroundState get_ground_state() const;
 	virtual void update(float p_delta);
 	Vector3 get_walk_stairs_step_up() const;
+	Transform3D get_interpolated_global_transform() const;
 	JoltCharacterBody3D();
 	~JoltCharacterBody3D();
 
@@ -223,14 +223,13 @@ void HBLedgeTraversalController::_handle_limbs() {
 }
 
 Transform3D HBLedgeTraversalController::calculate_limb_trf(HBAgentParkourLedge *p_ledge, float p_agent_radius, float p_limb_offset_diff, float p_agent_offset, const AgentProceduralAnimator::AgentLimb p_limb) const {
-	Ref<Curve3D> curve = p_ledge->get_curve();
 	real_t offset_diff = p_limb_offset_diff;
 	Transform3D body_trf = p_ledge->get_ledge_transform_at_offset(p_agent_offset);
 
-	Transform3D limb_trf = curve->sample_baked_with_rotation(Math::fposmod(p_agent_offset + offset_diff, curve->get_baked_length()));
+	Transform3D limb_trf = p_ledge->sample_ledge_frame(p_agent_offset + offset_diff);
 	const int MAX_ITERS = 32;
 	for (int i = 0; i < MAX_ITERS; i++) {
-		limb_trf = curve->sample_baked_with_rotation(Math::fposmod(p_agent_offset + offset_diff, curve->get_baked_length()));
+		limb_trf = p_ledge->sample_ledge_frame(p_agent_offset + offset_diff);
 		if (limb_trf.origin.distance_to(body_trf.origin) <= p_agent_radius) {
 			break;
 		}
@@ -55,6 +55,8 @@ void HBNPCAgent::_on_show_pathfinding_updated() {
 NavigationAgent3D *HBNPCAgent::get_navigation_agent() const {
 	if (!navigation_agent) {
 		const_cast<HBNPCAgent *>(this)->navigation_agent = memnew(NavigationAgent3D);
+		// Patrol and approach target changes would otherwise each run a path query on the main thread.
+		navigation_agent->set_use_async_path_queries(true);
 		const_cast<HBNPCAgent *>(this)->add_child(navigation_agent);
 	}
 	return navigation_agent;
@@ -67,6 +69,11 @@ void HBNPCAgent::set_navigation_target_position(const Vector3 &p_target_position
 bool HBNPCAgent::move_to_target(float p_delta, bool p_run) {
 	set_movement_input(Vector3());
 
+	if (navigation_agent->is_path_query_pending() && navigation_agent->get_current_navigation_path().is_empty()) {
+		// Still waiting for the first path.
+		return false;
+	}
+
 	Vector3 next_pos = navigation_agent->get_next_path_position();
 	Vector3 dir = get_global_position().direction_to(next_pos);
 	dir.y = 0.0;
@@ -0,0 +1,96 @@
+/**************************************************************************/
+/*  test_agent_parkour_ledge.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                               SWANSONG                                 */
+/*                          https://eirteam.moe                           */
+/**************************************************************************/
+/* Copyright (c) 2023-present Álex Román Núñez (EIRTeam).                 */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_AGENT_PARKOUR_LEDGE_H
+#define TEST_AGENT_PARKOUR_LEDGE_H
+
+#include "modules/game/agent_parkour.h"
+#include "scene/main/window.h"
+#include "tests/test_macros.h"
+
+namespace TestAgentParkourLedge {
+
+const float OFFSET_TOLERANCE = 0.05f;
+
+Ref<Curve3D> create_curve() {
+	Ref<Curve3D> curve;
+	curve.instantiate();
+	curve->add_point(Vector3(0.0f, 0.0f, 0.0f));
+	curve->add_point(Vector3(2.0f, 0.0f, 0.0f));
+	curve->add_point(Vector3(2.0f, 0.0f, 2.0f));
+	return curve;
+}
+
+void check_offsets_match(HBAgentParkourLedge *p_ledge, const Ref<Curve3D> &p_curve) {
+	// Away from corners, where the baked curve and the ledge's frame table differ the most.
+	const Vector3 positions[] = {
+		Vector3(1.0f, 0.2f, 0.1f),
+		Vector3(3.0f, -0.3f, 0.2f),
+		Vector3(2.5f, 0.0f, 1.5f),
+	};
+	for (const Vector3 &position : positions) {
+		const float expected = p_curve->get_closest_offset(position);
+		const float offset = p_ledge->get_closest_offset(position);
+		CHECK_MESSAGE(Math::abs(offset - expected) < OFFSET_TOLERANCE, vformat("Closest offset to %s should be %f, got %f.", position, expected, offset));
+	}
+}
+
+TEST_CASE("[SceneTree][HBAgentParkourLedge] Closest offset follows edits to the ledge curve") {
+	HBAgentParkourLedge *ledge = memnew(HBAgentParkourLedge);
+	SceneTree::get_singleton()->get_root()->add_child(ledge);
+
+	Ref<Curve3D> curve = create_curve();
+	ledge->set_curve(curve);
+	check_offsets_match(ledge, curve);
+
+	SUBCASE("Editing a point rebuilds the acceleration structure") {
+		curve->set_point_position(2, Vector3(4.0f, 0.0f, 0.0f));
+		check_offsets_match(ledge, curve);
+	}
+
+	SUBCASE("Baked data from a different curve is not used") {
+		const Dictionary baked_data = ledge->get("ledge_acceleration_data");
+
+		HBAgentParkourLedge *other_ledge = memnew(HBAgentParkourLedge);
+		SceneTree::get_singleton()->get_root()->add_child(other_ledge);
+		Ref<Curve3D> other_curve = create_curve();
+		other_curve->set_point_position(2, Vector3(4.0f, 0.0f, 0.0f));
+		other_ledge->set_curve(other_curve);
+		other_ledge->set("ledge_acceleration_data", baked_data);
+		check_offsets_match(other_ledge, other_curve);
+
+		memdelete(other_ledge);
+	}
+
+	memdelete(ledge);
+}
+
+} // namespace TestAgentParkourLedge
+
+#endif // TEST_AGENT_PARKOUR_LEDGE_H
@@ -0,0 +1,106 @@
+/**************************************************************************/
+/*  test_epas_ground_cache.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                               SWANSONG                                 */
+/*                          https://eirteam.moe                           */
+/**************************************************************************/
+/* Copyright (c) 2023-present Álex Román Núñez (EIRTeam).                 */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_EPAS_GROUND_CACHE_H
+#define TEST_EPAS_GROUND_CACHE_H
+
+#include "modules/game/animation_system/epas_ground_cache.h"
+#include "tests/test_macros.h"
+
+namespace TestEPASGroundCache {
+
+RID create_static_box(PhysicsServer3D *p_server, RID p_space, RID p_shape, const Vector3 &p_position) {
+	const RID body = p_server->body_create();
+	p_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_STATIC);
+	p_server->body_add_shape(body, p_shape);
+	p_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), p_position));
+	p_server->body_set_space(body, p_space);
+	return body;
+}
+
+TEST_CASE("[SceneTree][EPASGroundCache] Ground under an overhang is not mixed up with the overhang itself") {
+	PhysicsServer3D *server = PhysicsServer3D::get_singleton();
+
+	const RID space = server->space_create();
+	server->space_set_active(space, true);
+
+	// Floor with its top at y = 0 and a slab overhanging it with its top at y = 2.2.
+	const RID floor_shape = server->box_shape_create();
+	server->shape_set_data(floor_shape, Vector3(5.0, 0.5, 5.0));
+	const RID floor = create_static_box(server, space, floor_shape, Vector3(0.0, -0.5, 0.0));
+
+	const RID overhang_shape = server->box_shape_create();
+	server->shape_set_data(overhang_shape, Vector3(1.0, 0.1, 1.0));
+	const RID overhang = create_static_box(server, space, overhang_shape, Vector3(1.0, 2.1, 1.0));
+
+	server->step(1.0 / 60.0);
+	server->flush_queries();
+
+	PhysicsDirectSpaceState3D *dss = server->space_get_direct_state(space);
+	REQUIRE(dss != nullptr);
+
+	EPASGroundCache cache;
+	cache.set_collision_mask(1);
+	EPASGroundCache::Sample sample;
+
+	// Standing on top of the overhang.
+	cache.begin_frame(Vector3(1.0, 2.2, 1.0));
+	REQUIRE(cache.sample(dss, Vector3(1.05, 3.2, 1.05), sample));
+	CHECK(sample.position.y == doctest::Approx(2.2));
+
+	SUBCASE("Sampling the same cell from below the overhang hits the floor") {
+		REQUIRE(cache.sample(dss, Vector3(1.05, 1.0, 1.05), sample));
+		CHECK_MESSAGE(sample.position.y == doctest::Approx(0.0), "The cell cached for the overhang must not be reused under it.");
+		CHECK(cache.get_probes_this_frame() == 2);
+
+		// Queries starting around the same height reuse the floor cell.
+		REQUIRE(cache.sample(dss, Vector3(1.05, 1.1, 1.05), sample));
+		CHECK(sample.position.y == doctest::Approx(0.0));
+		CHECK(cache.get_probes_this_frame() == 2);
+	}
+
+	SUBCASE("Dropping below the overhang invalidates what was cached on top of it") {
+		cache.begin_frame(Vector3(1.0, 0.0, 1.0));
+		cache.prefetch(dss, Vector3(1.05, 1.0, 1.05));
+		CHECK(cache.get_probes_this_frame() == 1);
+		REQUIRE(cache.sample(dss, Vector3(1.05, 1.0, 1.05), sample));
+		CHECK(sample.position.y == doctest::Approx(0.0));
+		CHECK_MESSAGE(cache.get_probes_this_frame() == 1, "The prefetched cell should be used without probing again.");
+	}
+
+	server->free(overhang);
+	server->free(overhang_shape);
+	server->free(floor);
+	server->free(floor_shape);
+	server->free(space);
+}
+
+} // namespace TestEPASGroundCache
+
+#endif // TEST_EPAS_GROUND_CACHE_H
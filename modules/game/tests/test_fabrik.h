@@ -0,0 +1,125 @@
+/**************************************************************************/
+/*  test_fabrik.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                               SWANSONG                                 */
+/*                          https://eirteam.moe                           */
+/**************************************************************************/
+/* Copyright (c) 2023-present Álex Román Núñez (EIRTeam).                 */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FABRIK_H
+#define TEST_FABRIK_H
+
+#include "modules/game/fabrik/fabrik.h"
+#include "tests/test_macros.h"
+
+namespace TestFABRIK {
+
+const float POSITION_TOLERANCE = 0.001f;
+
+// A slightly bent chain pointing up, bent so the pole constraint has a well defined bend plane.
+// The hinge goes on the second joint, like the knee or elbow of FABRIKLimbSolver.
+Ref<FABRIKSolver> create_chain(int p_joint_count, const Vector3 &p_target, bool p_use_pole, bool p_use_hinge) {
+	Ref<FABRIKSolver> solver;
+	solver.instantiate();
+	solver->set_joint_count(p_joint_count);
+	solver->set_joint_transform(0, Transform3D(Basis(), Vector3(0.1f, 1.0f, 0.0f)));
+	for (int i = 1; i < p_joint_count; i++) {
+		solver->set_joint_transform(i, Transform3D(Basis(), Vector3(0.0f, 0.5f, i % 2 == 0 ? -0.1f : 0.15f)));
+	}
+	solver->calculate_distances();
+	solver->set_joint_hinge_enabled(1, p_use_hinge);
+	solver->set_use_pole_constraint(p_use_pole);
+	solver->set_pole_position(Vector3(0.0f, 1.5f, 2.0f));
+	solver->set_target_position(p_target);
+	return solver;
+}
+
+void check_chains_match(int p_chain_idx, const Ref<FABRIKSolver> &p_reference, const Ref<FABRIKSolver> &p_batched) {
+	REQUIRE(p_reference->get_joint_count() == p_batched->get_joint_count());
+	for (int i = 0; i < p_reference->get_joint_count(); i++) {
+		const Vector3 reference_position = p_reference->get_global_trf(i).origin;
+		const Vector3 batched_position = p_batched->get_global_trf(i).origin;
+		CHECK_MESSAGE(reference_position.distance_to(batched_position) < POSITION_TOLERANCE,
+				vformat("Joint %d of chain %d should be at %s but the batch solver put it at %s.", i, p_chain_idx, reference_position, batched_position));
+	}
+}
+
+TEST_CASE("[SceneTree][FABRIK] Batch solver matches solving each chain on its own") {
+	struct ChainSetup {
+		int joint_count;
+		Vector3 target;
+		bool use_pole;
+		bool use_hinge;
+		bool reachable;
+	};
+	const ChainSetup setups[] = {
+		{ 3, Vector3(0.4f, 1.6f, 0.3f), false, false, true },
+		{ 3, Vector3(0.4f, 1.6f, 0.3f), true, false, true },
+		{ 3, Vector3(0.4f, 1.6f, 0.3f), true, true, true },
+		{ 4, Vector3(-0.3f, 1.9f, 0.5f), false, false, true },
+		{ 4, Vector3(-0.3f, 1.9f, 0.5f), true, false, true },
+		{ 4, Vector3(-0.3f, 1.9f, 0.5f), false, true, true },
+		{ 3, Vector3(0.0f, 10.0f, 0.0f), false, false, false },
+		{ 4, Vector3(5.0f, 1.0f, 0.0f), true, false, false },
+		{ 3, Vector3(3.0f, 2.0f, 1.0f), true, true, false },
+	};
+
+	LocalVector<Ref<FABRIKSolver>> reference_solvers;
+	LocalVector<Ref<FABRIKSolver>> batched_solvers;
+	FABRIKBatchSolver batch_solver;
+	for (const ChainSetup &setup : setups) {
+		Ref<FABRIKSolver> reference = create_chain(setup.joint_count, setup.target, setup.use_pole, setup.use_hinge);
+		reference->solve(10);
+		reference_solvers.push_back(reference);
+
+		Ref<FABRIKSolver> batched = create_chain(setup.joint_count, setup.target, setup.use_pole, setup.use_hinge);
+		batch_solver.add_solver(batched.ptr());
+		batched_solvers.push_back(batched);
+	}
+	batch_solver.solve(10);
+
+	for (uint32_t i = 0; i < reference_solvers.size(); i++) {
+		check_chains_match(i, reference_solvers[i], batched_solvers[i]);
+	}
+
+	// Unreachable chains should end up fully stretched, one chain length away from their base.
+	// Hinges bend the chain back after stretching it, so those are only checked against the reference.
+	for (uint32_t i = 0; i < batched_solvers.size(); i++) {
+		if (setups[i].reachable || setups[i].use_hinge) {
+			continue;
+		}
+		const Ref<FABRIKSolver> &solver = batched_solvers[i];
+		const int end_idx = solver->get_joint_count() - 1;
+		float chain_length = 0.0f;
+		for (int j = 1; j <= end_idx; j++) {
+			chain_length += solver->get_joint_transform(j).origin.length();
+		}
+		const Vector3 base = solver->get_global_trf(0).origin;
+		CHECK(base.distance_to(solver->get_global_trf(end_idx).origin) == doctest::Approx(chain_length).epsilon(0.001));
+	}
+}
+
+} // namespace TestFABRIK
+
+#endif // TEST_FABRIK_H
@@ -32,6 +32,7 @@
 #ifdef DEBUG_ENABLED
 #include "ImGuizmo.h"
 #include "core/io/config_file.h"
+#include "core/templates/flat_hash_map.h"
 #include "imgui.h"
 #include "imgui_neo_sequencer.h"
 #include "scene/gui/subviewport_container.h"
@@ -79,7 +80,7 @@ private:
 	RID vertex_buffer;
 	int vertex_buffer_size = 0;
 	HashSet<uint64_t> used_textures;
-	HashMap<uint64_t, RID> uniform_sets;
+	FlatHashMap<uint64_t, RID> uniform_sets;
 	Ref<ImageTexture> font_texture;
 	PackedFloat32Array push_constant_buffer;
 	RenderingDevice::VertexFormatID vertex_format;
@@ -417,7 +417,7 @@ float JoltGeneric6DOFJointImpl3D::get_applied_force() const {
 	JoltSpace3D* space = get_space();
 	ERR_FAIL_NULL_D(space);
 
-	const float last_step = space->get_last_step();
+	const float last_step = space->get_last_collision_step();
 	QUIET_FAIL_COND_D(last_step == 0.0f);
 
 	return constraint->GetTotalLambdaPosition().Length() / last_step;
@@ -430,7 +430,7 @@ float JoltGeneric6DOFJointImpl3D::get_applied_torque() const {
 	JoltSpace3D* space = get_space();
 	ERR_FAIL_NULL_D(space);
 
-	const float last_step = space->get_last_step();
+	const float last_step = space->get_last_collision_step();
 	QUIET_FAIL_COND_D(last_step == 0.0f);
 
 	return constraint->GetTotalLambdaRotation().Length() / last_step;
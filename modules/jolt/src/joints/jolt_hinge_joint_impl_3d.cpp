@@ -221,7 +221,7 @@ float JoltHingeJointImpl3D::get_applied_force() const {
 	JoltSpace3D* space = get_space();
 	ERR_FAIL_NULL_D(space);
 
-	const float last_step = space->get_last_step();
+	const float last_step = space->get_last_collision_step();
 	QUIET_FAIL_COND_D(last_step == 0.0f);
 
 	if (_is_fixed()) {
@@ -239,7 +239,7 @@ float JoltHingeJointImpl3D::get_applied_torque() const {
 	JoltSpace3D* space = get_space();
 	ERR_FAIL_NULL_D(space);
 
-	const float last_step = space->get_last_step();
+	const float last_step = space->get_last_collision_step();
 	QUIET_FAIL_COND_D(last_step == 0.0f);
 
 	if (_is_fixed()) {
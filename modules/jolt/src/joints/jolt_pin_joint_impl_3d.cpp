@@ -100,7 +100,7 @@ float JoltPinJointImpl3D::get_applied_force() const {
 	JoltSpace3D* space = get_space();
 	ERR_FAIL_NULL_D(space);
 
-	const float last_step = space->get_last_step();
+	const float last_step = space->get_last_collision_step();
 	QUIET_FAIL_COND_D(last_step == 0.0f);
 
 	return constraint->GetTotalLambdaPosition().Length() / last_step;
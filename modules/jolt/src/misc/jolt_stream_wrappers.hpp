@@ -1,5 +1,84 @@
 #pragma once
 
+class JoltByteStreamOut final : public JPH::StreamOut {
+public:
+	explicit JoltByteStreamOut(PackedByteArray& p_bytes)
+		: bytes(p_bytes) { }
+
+	void WriteBytes(const void* p_data, size_t p_bytes) override {
+		const int64_t offset = bytes.size();
+		bytes.resize(offset + (int64_t)p_bytes);
+		memcpy(bytes.ptrw() + offset, p_data, p_bytes);
+	}
+
+	bool IsFailed() const override { return false; }
+
+private:
+	PackedByteArray& bytes;
+};
+
+class JoltByteStreamIn final : public JPH::StreamIn {
+public:
+	explicit JoltByteStreamIn(const PackedByteArray& p_bytes)
+		: bytes(p_bytes) { }
+
+	void ReadBytes(void* p_data, size_t p_bytes) override {
+		if (failed || position + (int64_t)p_bytes > bytes.size()) {
+			memset(p_data, 0, p_bytes);
+			failed = true;
+			return;
+		}
+
+		memcpy(p_data, bytes.ptr() + position, p_bytes);
+		position += (int64_t)p_bytes;
+	}
+
+	bool IsEOF() const override { return position >= bytes.size(); }
+
+	bool IsFailed() const override { return failed; }
+
+private:
+	const PackedByteArray& bytes;
+
+	int64_t position = 0;
+
+	bool failed = false;
+};
+
+class JoltByteStateRecorder final : public JPH::StateRecorder {
+public:
+	explicit JoltByteStateRecorder(PackedByteArray& p_bytes)
+		: bytes(p_bytes) { }
+
+	void WriteBytes(const void* p_data, size_t p_bytes) override {
+		const int64_t offset = bytes.size();
+		bytes.resize(offset + (int64_t)p_bytes);
+		memcpy(bytes.ptrw() + offset, p_data, p_bytes);
+	}
+
+	void ReadBytes(void* p_data, size_t p_bytes) override {
+		if (failed || position + (int64_t)p_bytes > bytes.size()) {
+			memset(p_data, 0, p_bytes);
+			failed = true;
+			return;
+		}
+
+		memcpy(p_data, bytes.ptr() + position, p_bytes);
+		position += (int64_t)p_bytes;
+	}
+
+	bool IsEOF() const override { return position >= bytes.size(); }
+
+	bool IsFailed() const override { return failed; }
+
+private:
+	PackedByteArray& bytes;
+
+	int64_t position = 0;
+
+	bool failed = false;
+};
+
 #ifdef GDJ_CONFIG_EDITOR
 
 class JoltStreamOutWrapper final : public JPH::StreamOut {
@@ -374,12 +374,22 @@ bool JoltAreaImpl3D::shape_exited(
 		area_shape_exited(p_body_id, p_other_shape_id, p_self_shape_id);
 }
 
-void JoltAreaImpl3D::call_queries([[maybe_unused]] JPH::Body& p_jolt_body) {
+void JoltAreaImpl3D::call_queries() {
+	call_queries_enqueued = false;
+
 	_flush_events(bodies_by_id, body_monitor_callback);
 	_flush_events(areas_by_id, area_monitor_callback);
 }
 
 JPH::BroadPhaseLayer JoltAreaImpl3D::_get_broad_phase_layer() const {
+	const uint32_t dedicated_layers = JoltProjectSettings::get_dedicated_area_layers();
+
+	if (JoltBroadPhaseLayer::is_exclusive_to(collision_layer, dedicated_layers)) {
+		return monitorable
+			? JoltBroadPhaseLayer::AREA_DETECTABLE_DEDICATED
+			: JoltBroadPhaseLayer::AREA_UNDETECTABLE_DEDICATED;
+	}
+
 	return monitorable
 		? JoltBroadPhaseLayer::AREA_DETECTABLE
 		: JoltBroadPhaseLayer::AREA_UNDETECTABLE;
@@ -453,6 +463,8 @@ void JoltAreaImpl3D::_add_shape_pair(
 	shape_indices.self = find_shape_index(p_self_shape_id);
 
 	p_overlap.pending_added.push_back(shape_indices);
+
+	_enqueue_call_queries();
 }
 
 bool JoltAreaImpl3D::_remove_shape_pair(
@@ -469,13 +481,41 @@ bool JoltAreaImpl3D::_remove_shape_pair(
 	p_overlap.pending_removed.push_back(shape_pair->second);
 	p_overlap.shape_pairs.remove(shape_pair);
 
+	_enqueue_call_queries();
+
 	return true;
 }
 
+void JoltAreaImpl3D::_enqueue_call_queries() {
+	if (call_queries_enqueued || space == nullptr) {
+		return;
+	}
+
+	space->enqueue_call_queries(this);
+
+	call_queries_enqueued = true;
+}
+
+void JoltAreaImpl3D::_coalesce_events(Overlap& p_overlap) {
+	// Objects moving along the edge of an area can exit and re-enter it within the same tick, or get
+	// their shape pairs shifted without the shape indices actually changing, in which case the
+	// removal and addition cancel each other out and there's no need to report either of them.
+	for (int32_t i = p_overlap.pending_removed.size() - 1; i >= 0; --i) {
+		const int32_t added_index = p_overlap.pending_added.find(p_overlap.pending_removed[i]);
+
+		if (added_index != -1) {
+			p_overlap.pending_added.remove_at(added_index);
+			p_overlap.pending_removed.remove_at(i);
+		}
+	}
+}
+
 void JoltAreaImpl3D::_flush_events(OverlapsById& p_objects, const Callable& p_callback) {
 	p_objects.erase_if([&](auto& p_pair) {
 		auto& [id, overlap] = p_pair;
 
+		_coalesce_events(overlap);
+
 		if (p_callback.is_valid()) {
 			for (auto& shape_indices : overlap.pending_removed) {
 				_report_event(
@@ -556,6 +596,8 @@ void JoltAreaImpl3D::_force_bodies_entered() {
 			body.pending_added.push_back(index_pair);
 		}
 	}
+
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_force_bodies_exited(bool p_remove) {
@@ -569,6 +611,8 @@ void JoltAreaImpl3D::_force_bodies_exited(bool p_remove) {
 			_notify_body_exited(id);
 		}
 	}
+
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_force_areas_entered() {
@@ -577,6 +621,8 @@ void JoltAreaImpl3D::_force_areas_entered() {
 			area.pending_added.push_back(index_pair);
 		}
 	}
+
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_force_areas_exited(bool p_remove) {
@@ -589,6 +635,8 @@ void JoltAreaImpl3D::_force_areas_exited(bool p_remove) {
 			area.shape_pairs.clear();
 		}
 	}
+
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_update_group_filter() {
@@ -618,6 +666,11 @@ void JoltAreaImpl3D::_space_changing() {
 		// and as such cannot report any exits, so we're forced to do it manually instead.
 		_force_bodies_exited(true);
 		_force_areas_exited(true);
+
+		if (call_queries_enqueued) {
+			space->dequeue_call_queries(this);
+			call_queries_enqueued = false;
+		}
 	}
 }
 
@@ -626,6 +679,9 @@ void JoltAreaImpl3D::_space_changed() {
 
 	_update_group_filter();
 	_update_default_gravity();
+
+	// Any events left pending from the previous space still need to be reported in this one.
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_body_monitoring_changed() {
@@ -33,6 +33,10 @@ class JoltAreaImpl3D final : public JoltShapedObjectImpl3D {
 	};
 
 	struct ShapeIndexPair {
+		friend bool operator==(const ShapeIndexPair& p_lhs, const ShapeIndexPair& p_rhs) {
+			return p_lhs.other == p_rhs.other && p_lhs.self == p_rhs.self;
+		}
+
 		int32_t other = -1;
 
 		int32_t self = -1;
@@ -167,7 +171,7 @@ public:
 		const JPH::SubShapeID& p_self_shape_id
 	);
 
-	void call_queries(JPH::Body& p_jolt_body);
+	void call_queries();
 
 	bool has_custom_center_of_mass() const override { return false; }
 
@@ -195,6 +199,10 @@ private:
 		const JPH::SubShapeID& p_self_shape_id
 	);
 
+	void _enqueue_call_queries();
+
+	void _coalesce_events(Overlap& p_overlap);
+
 	void _flush_events(OverlapsById& p_objects, const Callable& p_callback);
 
 	void _report_event(
@@ -263,4 +271,6 @@ private:
 	bool monitorable = false;
 
 	bool point_gravity = false;
+
+	bool call_queries_enqueued = false;
 };
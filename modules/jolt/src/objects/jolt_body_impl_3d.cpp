@@ -69,6 +69,9 @@ void JoltBodyImpl3D::set_transform(const Transform3D& p_transform) {
 			to_jolt(new_transform.basis),
 			JPH::EActivation::DontActivate
 		);
+
+		// Teleporting the body shouldn't be interpolated
+		previous_transform_step = 0;
 	}
 
 	_transform_changed();
@@ -813,7 +816,7 @@ void JoltBodyImpl3D::remove_joint(JoltJointImpl3D* p_joint) {
 	_joints_changed();
 }
 
-void JoltBodyImpl3D::call_queries([[maybe_unused]] JPH::Body& p_jolt_body) {
+void JoltBodyImpl3D::call_queries() {
 	if (!sync_state) {
 		return;
 	}
@@ -861,6 +864,9 @@ void JoltBodyImpl3D::call_queries([[maybe_unused]] JPH::Body& p_jolt_body) {
 void JoltBodyImpl3D::pre_step(float p_step, JPH::Body& p_jolt_body) {
 	JoltObjectImpl3D::pre_step(p_step, p_jolt_body);
 
+	previous_transform = {to_godot(p_jolt_body.GetRotation()), to_godot(p_jolt_body.GetPosition())};
+	previous_transform_step = space->get_step_count();
+
 	switch (mode) {
 		case PhysicsServer3D::BODY_MODE_STATIC: {
 			_pre_step_static(p_step, p_jolt_body);
@@ -893,7 +899,32 @@ void JoltBodyImpl3D::move_kinematic(float p_step, JPH::Body& p_jolt_body) {
 
 	p_jolt_body.MoveKinematic(new_position, new_rotation, p_step);
 
-	sync_state = true;
+	_enqueue_call_queries();
+}
+
+Transform3D JoltBodyImpl3D::get_interpolated_transform(float p_fraction) const {
+	const Transform3D current_transform = get_transform_scaled();
+
+	// Bodies that weren't pre-stepped during the last step (e.g. sleeping ones) didn't move
+	if (space == nullptr || previous_transform_step != space->get_step_count()) {
+		return current_transform;
+	}
+
+	return previous_transform.scaled_local(scale).interpolate_with(current_transform, p_fraction);
+}
+
+void JoltBodyImpl3D::state_restored(const JPH::Body& p_jolt_body) {
+	if (is_kinematic()) {
+		// Otherwise the next step would move the body back to where it was before the restore
+		kinematic_transform = {
+			to_godot(p_jolt_body.GetRotation()),
+			to_godot(p_jolt_body.GetPosition())
+		};
+	}
+
+	previous_transform_step = 0;
+
+	_enqueue_call_queries();
 }
 
 JoltPhysicsDirectBodyState3D* JoltBodyImpl3D::get_direct_state() {
@@ -1114,7 +1145,11 @@ bool JoltBodyImpl3D::can_interact_with(const JoltAreaImpl3D& p_other) const {
 JPH::BroadPhaseLayer JoltBodyImpl3D::_get_broad_phase_layer() const {
 	switch (mode) {
 		case PhysicsServer3D::BODY_MODE_STATIC: {
-			return JoltBroadPhaseLayer::BODY_STATIC;
+			const uint32_t query_only_layers = JoltProjectSettings::get_query_only_static_layers();
+
+			return JoltBroadPhaseLayer::is_exclusive_to(collision_layer, query_only_layers)
+				? JoltBroadPhaseLayer::BODY_STATIC_QUERY_ONLY
+				: JoltBroadPhaseLayer::BODY_STATIC;
 		}
 		case PhysicsServer3D::BODY_MODE_KINEMATIC:
 		case PhysicsServer3D::BODY_MODE_RIGID:
@@ -1225,7 +1260,7 @@ void JoltBodyImpl3D::_integrate_forces(float p_step, JPH::Body& p_jolt_body) {
 		p_jolt_body.AddTorque(to_jolt(constant_torque));
 	}
 
-	sync_state = true;
+	_enqueue_call_queries();
 }
 
 void JoltBodyImpl3D::_pre_step_static(
@@ -1248,7 +1283,7 @@ void JoltBodyImpl3D::_pre_step_kinematic(float p_step, JPH::Body& p_jolt_body) {
 		// HACK(mihe): This seems to emulate the behavior of Godot Physics, where kinematic bodies
 		// are set as active (and thereby have their state synchronized on every step) only if its
 		// max reported contacts is non-zero.
-		sync_state = true;
+		_enqueue_call_queries();
 	}
 }
 
@@ -1477,7 +1512,40 @@ void JoltBodyImpl3D::_update_group_filter() {
 	body->GetCollisionGroup().SetGroupFilter(group_filter);
 }
 
+void JoltBodyImpl3D::_enqueue_call_queries() {
+	if (sync_state || space == nullptr) {
+		return;
+	}
+
+	space->enqueue_call_queries(this);
+
+	sync_state = true;
+}
+
+void JoltBodyImpl3D::_update_pre_step_tracking() {
+	if (space == nullptr) {
+		return;
+	}
+
+	// Kinematic bodies need to be moved, and bodies reporting contacts need to have their contacts
+	// reset, regardless of whether they're sleeping or not.
+	const bool should_track = is_kinematic() || reports_contacts();
+
+	if (should_track == pre_step_tracked) {
+		return;
+	}
+
+	if (should_track) {
+		space->add_pre_step_body(this);
+	} else {
+		space->remove_pre_step_body(this);
+	}
+
+	pre_step_tracked = should_track;
+}
+
 void JoltBodyImpl3D::_mode_changed() {
+	_update_pre_step_tracking();
 	_update_object_layer();
 	_update_kinematic_transform();
 	_update_mass_properties();
@@ -1496,6 +1564,20 @@ void JoltBodyImpl3D::_space_changing() {
 	JoltShapedObjectImpl3D::_space_changing();
 
 	_destroy_joint_constraints();
+
+	if (space != nullptr) {
+		if (sync_state) {
+			space->dequeue_call_queries(this);
+			sync_state = false;
+		}
+
+		if (pre_step_tracked) {
+			space->remove_pre_step_body(this);
+			pre_step_tracked = false;
+		}
+	}
+
+	previous_transform_step = 0;
 }
 
 void JoltBodyImpl3D::_space_changed() {
@@ -1506,8 +1588,7 @@ void JoltBodyImpl3D::_space_changed() {
 	_update_group_filter();
 	_update_joint_constraints();
 	_areas_changed();
-
-	sync_state = false;
+	_update_pre_step_tracking();
 }
 
 void JoltBodyImpl3D::_areas_changed() {
@@ -1538,5 +1619,6 @@ void JoltBodyImpl3D::_axis_lock_changed() {
 
 void JoltBodyImpl3D::_contact_reporting_changed() {
 	_update_possible_kinematic_contacts();
+	_update_pre_step_tracking();
 	wake_up();
 }
@@ -169,16 +169,22 @@ public:
 
 	void remove_joint(JoltJointImpl3D* p_joint);
 
-	void call_queries(JPH::Body& p_jolt_body);
+	void call_queries();
 
 	void pre_step(float p_step, JPH::Body& p_jolt_body) override;
 
 	void move_kinematic(float p_step, JPH::Body& p_jolt_body);
 
+	Transform3D get_interpolated_transform(float p_fraction) const;
+
+	void state_restored(const JPH::Body& p_jolt_body);
+
 	JoltPhysicsDirectBodyState3D* get_direct_state();
 
 	PhysicsServer3D::BodyMode get_mode() const { return mode; }
 
+	bool is_pre_step_tracked() const { return pre_step_tracked; }
+
 	void set_mode(PhysicsServer3D::BodyMode p_mode);
 
 	bool is_static() const { return mode == PhysicsServer3D::BODY_MODE_STATIC; }
@@ -292,6 +298,10 @@ private:
 
 	void _destroy_joint_constraints();
 
+	void _enqueue_call_queries();
+
+	void _update_pre_step_tracking();
+
 	void _mode_changed();
 
 	void _shapes_built() override;
@@ -326,6 +336,10 @@ private:
 
 	Transform3D kinematic_transform;
 
+	// The transform at the start of the last step, or a stale one if `previous_transform_step`
+	// doesn't match the step count of the space, which happens when the body wasn't pre-stepped.
+	Transform3D previous_transform;
+
 	Vector3 inertia;
 
 	Vector3 center_of_mass_custom;
@@ -366,12 +380,16 @@ private:
 
 	float collision_priority = 1.0f;
 
+	uint64_t previous_transform_step = 0;
+
 	int32_t contact_count = 0;
 
 	uint32_t locked_axes = 0;
 
 	bool sync_state = false;
 
+	bool pre_step_tracked = false;
+
 	bool custom_center_of_mass = false;
 
 	bool custom_integrator = false;
@@ -113,10 +113,7 @@ void JoltObjectImpl3D::pre_step(
 	[[maybe_unused]] JPH::Body& p_jolt_body
 ) { }
 
-void JoltObjectImpl3D::post_step(
-	[[maybe_unused]] float p_step,
-	[[maybe_unused]] JPH::Body& p_jolt_body
-) { }
+void JoltObjectImpl3D::post_step([[maybe_unused]] float p_step) { }
 
 String JoltObjectImpl3D::to_string() const {
 	Object* instance = ObjectDB::get_instance(instance_id);
@@ -115,7 +115,7 @@ public:
 
 	virtual void pre_step(float p_step, JPH::Body& p_jolt_body);
 
-	virtual void post_step(float p_step, JPH::Body& p_jolt_body);
+	virtual void post_step(float p_step);
 
 	String to_string() const;
 
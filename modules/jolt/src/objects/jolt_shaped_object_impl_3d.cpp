@@ -183,6 +183,10 @@ void JoltShapedObjectImpl3D::update_shape() {
 	const JoltWritableBody3D body = space->write_body(jolt_id);
 	ERR_FAIL_COND(body.is_invalid());
 
+	if (previous_jolt_shape == nullptr) {
+		space->enqueue_shapes_changed(this);
+	}
+
 	previous_jolt_shape = jolt_shape;
 	jolt_shape = build_shape();
 
@@ -326,8 +330,8 @@ void JoltShapedObjectImpl3D::set_shape_disabled(int32_t p_index, bool p_disabled
 	_shapes_changed();
 }
 
-void JoltShapedObjectImpl3D::post_step(float p_step, JPH::Body& p_jolt_body) {
-	JoltObjectImpl3D::post_step(p_step, p_jolt_body);
+void JoltShapedObjectImpl3D::post_step(float p_step) {
+	JoltObjectImpl3D::post_step(p_step);
 
 	previous_jolt_shape = nullptr;
 }
@@ -340,6 +344,11 @@ void JoltShapedObjectImpl3D::_space_changing() {
 	JoltObjectImpl3D::_space_changing();
 
 	if (space != nullptr) {
+		if (previous_jolt_shape != nullptr) {
+			space->dequeue_shapes_changed(this);
+			previous_jolt_shape = nullptr;
+		}
+
 		const JoltWritableBody3D body = space->write_body(jolt_id);
 		ERR_FAIL_COND(body.is_invalid());
 
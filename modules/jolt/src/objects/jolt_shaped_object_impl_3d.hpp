@@ -74,7 +74,7 @@ public:
 
 	void set_shape_disabled(int32_t p_index, bool p_disabled);
 
-	void post_step(float p_step, JPH::Body& p_jolt_body) override;
+	void post_step(float p_step) override;
 
 protected:
 	friend class JoltShapeImpl3D;
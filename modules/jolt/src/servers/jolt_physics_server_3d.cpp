@@ -9,6 +9,7 @@
 #include "objects/jolt_area_impl_3d.hpp"
 #include "objects/jolt_body_impl_3d.hpp"
 #include "objects/jolt_soft_body_impl_3d.hpp"
+#include "servers/jolt_project_settings.hpp"
 #include "shapes/jolt_box_shape_impl_3d.hpp"
 #include "shapes/jolt_capsule_shape_impl_3d.hpp"
 #include "shapes/jolt_concave_polygon_shape_impl_3d.hpp"
@@ -35,6 +36,16 @@ void JoltPhysicsServer3D::_bind_methods() {
 	BIND_METHOD(JoltPhysicsServer3D, space_dump_debug_snapshot, "space", "dir");
 #endif // GDJ_CONFIG_EDITOR
 
+	BIND_METHOD(JoltPhysicsServer3D, space_get_collision_steps, "space");
+	BIND_METHOD(JoltPhysicsServer3D, space_set_collision_steps, "space", "steps");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_save_state, "space");
+	BIND_METHOD(JoltPhysicsServer3D, space_restore_state, "space", "state");
+
+	BIND_METHOD(JoltPhysicsServer3D, body_get_interpolated_transform, "body", "fraction");
+
+	BIND_METHOD(JoltPhysicsServer3D, shape_bake_cache, "shape");
+
 	BIND_METHOD(JoltPhysicsServer3D, joint_get_enabled, "joint");
 	BIND_METHOD(JoltPhysicsServer3D, joint_set_enabled, "joint", "enabled");
 
@@ -1893,7 +1904,19 @@ void JoltPhysicsServer3D::_set_active(bool p_active) {
 }
 
 void JoltPhysicsServer3D::_init() {
-	job_system = new JoltJobSystem();
+	if (JoltProjectSettings::use_dedicated_job_threads()) {
+		// Jolt's own thread pool keeps its threads parked in between steps and preallocates all of
+		// its jobs, which avoids the per-task overhead of Godot's worker thread pool, at the cost of
+		// the threads not being shared with the rest of the engine.
+		job_system = new JPH::JobSystemThreadPool(
+			JPH::cMaxPhysicsJobs,
+			JPH::cMaxPhysicsBarriers,
+			JoltProjectSettings::get_dedicated_job_thread_count()
+		);
+	} else {
+		worker_pool_job_system = new JoltJobSystem();
+		job_system = worker_pool_job_system;
+	}
 }
 
 void JoltPhysicsServer3D::_step(double p_step) {
@@ -1902,11 +1925,15 @@ void JoltPhysicsServer3D::_step(double p_step) {
 	}
 
 	for (JoltSpace3D* active_space : active_spaces) {
-		job_system->pre_step();
+		if (worker_pool_job_system != nullptr) {
+			worker_pool_job_system->pre_step();
+		}
 
 		active_space->step((float)p_step);
 
-		job_system->post_step();
+		if (worker_pool_job_system != nullptr) {
+			worker_pool_job_system->post_step();
+		}
 	}
 }
 
@@ -1924,12 +1951,16 @@ void JoltPhysicsServer3D::_flush_queries() {
 	flushing_queries = false;
 
 #ifdef GDJ_CONFIG_EDITOR
-	job_system->flush_timings();
+	if (worker_pool_job_system != nullptr) {
+		worker_pool_job_system->flush_timings();
+	}
 #endif // GDJ_CONFIG_EDITOR
 }
 
 void JoltPhysicsServer3D::_finish() {
 	delete_safely(job_system);
+
+	worker_pool_job_system = nullptr;
 }
 
 bool JoltPhysicsServer3D::_is_flushing_queries() const {
@@ -2005,6 +2036,57 @@ void JoltPhysicsServer3D::space_dump_debug_snapshot(const RID& p_space, const St
 
 #endif // GDJ_CONFIG_EDITOR
 
+int32_t JoltPhysicsServer3D::space_get_collision_steps(const RID& p_space) const {
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->get_collision_steps();
+}
+
+void JoltPhysicsServer3D::space_set_collision_steps(const RID& p_space, int32_t p_steps) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->set_collision_steps(p_steps);
+}
+
+PackedByteArray JoltPhysicsServer3D::space_save_state(const RID& p_space) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->save_state();
+}
+
+bool JoltPhysicsServer3D::space_restore_state(const RID& p_space, const PackedByteArray& p_state) {
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return space->restore_state(p_state);
+}
+
+Transform3D JoltPhysicsServer3D::body_get_interpolated_transform(
+	const RID& p_body,
+	float p_fraction
+) const {
+	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL_D(body);
+
+	return body->get_interpolated_transform(p_fraction);
+}
+
+PackedByteArray JoltPhysicsServer3D::shape_bake_cache(const RID& p_shape) const {
+	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
+	ERR_FAIL_NULL_D(shape);
+
+	ERR_FAIL_COND_D_MSG(
+		shape->get_type() != SHAPE_CONCAVE_POLYGON,
+		"Failed to bake physics cache. "
+		"Only concave polygon shapes can have their physics cache baked."
+	);
+
+	return static_cast<JoltConcavePolygonShapeImpl3D*>(shape)->bake_cache();
+}
+
 bool JoltPhysicsServer3D::joint_get_enabled(const RID& p_joint) const {
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
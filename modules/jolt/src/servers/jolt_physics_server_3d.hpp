@@ -647,6 +647,18 @@ public:
 	void space_dump_debug_snapshot(const RID& p_space, const String& p_dir);
 #endif // GDJ_CONFIG_EDITOR
 
+	int32_t space_get_collision_steps(const RID& p_space) const;
+
+	void space_set_collision_steps(const RID& p_space, int32_t p_steps);
+
+	PackedByteArray space_save_state(const RID& p_space);
+
+	bool space_restore_state(const RID& p_space, const PackedByteArray& p_state);
+
+	Transform3D body_get_interpolated_transform(const RID& p_body, float p_fraction) const;
+
+	PackedByteArray shape_bake_cache(const RID& p_shape) const;
+
 	bool joint_get_enabled(const RID& p_joint) const;
 
 	void joint_set_enabled(const RID& p_joint, bool p_enabled);
@@ -797,7 +809,10 @@ private:
 
 	HashSetJolt<JoltSpace3D*> active_spaces;
 
-	JoltJobSystem* job_system = nullptr;
+	JPH::JobSystem* job_system = nullptr;
+
+	// Only set when running on Godot's worker thread pool, as opposed to dedicated threads
+	JoltJobSystem* worker_pool_job_system = nullptr;
 
 	bool active = true;
 
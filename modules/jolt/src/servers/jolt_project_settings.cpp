@@ -2,6 +2,11 @@
 
 namespace {
 
+enum JobSystemType : int32_t {
+	JOB_SYSTEM_WORKER_POOL,
+	JOB_SYSTEM_DEDICATED_THREADS
+};
+
 enum JointWorldNode : int32_t {
 	JOINT_WORLD_NODE_A,
 	JOINT_WORLD_NODE_B
@@ -26,6 +31,7 @@ constexpr char CCD_MAX_PENETRATION[] = "physics/jolt_3d/continuous_cd/max_penetr
 constexpr char RECOVERY_ITERATIONS[] = "physics/jolt_3d/kinematics/recovery_iterations";
 constexpr char RECOVERY_AMOUNT[] = "physics/jolt_3d/kinematics/recovery_amount";
 
+constexpr char COLLISION_STEPS[] = "physics/jolt_3d/solver/collision_steps";
 constexpr char POSITION_ITERATIONS[] = "physics/jolt_3d/solver/position_iterations";
 constexpr char VELOCITY_ITERATIONS[] = "physics/jolt_3d/solver/velocity_iterations";
 constexpr char POSITION_CORRECTION[] = "physics/jolt_3d/solver/position_correction";
@@ -41,6 +47,12 @@ constexpr char MAX_PAIRS[] = "physics/jolt_3d/limits/max_body_pairs";
 constexpr char MAX_CONTACTS[] = "physics/jolt_3d/limits/max_contact_constraints";
 constexpr char MAX_TEMP_MEMORY[] = "physics/jolt_3d/limits/max_temporary_memory";
 
+constexpr char QUERY_ONLY_STATIC_LAYERS[] = "physics/jolt_3d/broad_phase/query_only_static_layers";
+constexpr char DEDICATED_AREA_LAYERS[] = "physics/jolt_3d/broad_phase/dedicated_area_layers";
+
+constexpr char JOB_SYSTEM[] = "physics/jolt_3d/threading/job_system";
+constexpr char DEDICATED_THREAD_COUNT[] = "physics/jolt_3d/threading/dedicated_thread_count";
+
 constexpr char RUN_ON_SEPARATE_THREAD[] = "physics/3d/run_on_separate_thread";
 constexpr char MAX_THREADS[] = "threading/worker_pool/max_threads";
 
@@ -107,6 +119,14 @@ void register_setting_ranged(
 	register_setting(p_name, p_value, p_needs_restart, PROPERTY_HINT_RANGE, p_hint_string);
 }
 
+void register_setting_layers(
+	const String& p_name,
+	const Variant& p_value,
+	bool p_needs_restart = false
+) {
+	register_setting(p_name, p_value, p_needs_restart, PROPERTY_HINT_LAYERS_3D_PHYSICS, {});
+}
+
 void register_setting_enum(
 	const String& p_name,
 	const Variant& p_value,
@@ -158,6 +178,7 @@ void JoltProjectSettings::register_settings() {
 	register_setting_ranged(RECOVERY_ITERATIONS, 4, U"1,8,or_greater");
 	register_setting_ranged(RECOVERY_AMOUNT, 40.0f, U"0,100,0.1,suffix:%");
 
+	register_setting_ranged(COLLISION_STEPS, 1, U"1,8,or_greater");
 	register_setting_ranged(VELOCITY_ITERATIONS, 10, U"2,16,or_greater");
 	register_setting_ranged(POSITION_ITERATIONS, 2, U"1,16,or_greater");
 	register_setting_ranged(POSITION_CORRECTION, 20.0f, U"0,100,0.1,suffix:%");
@@ -172,6 +193,18 @@ void JoltProjectSettings::register_settings() {
 	register_setting_ranged(MAX_PAIRS, 65536, U"8,65536,or_greater");
 	register_setting_ranged(MAX_CONTACTS, 20480, U"8,20480,or_greater");
 	register_setting_ranged(MAX_TEMP_MEMORY, 32, U"1,32,or_greater,suffix:MiB");
+
+	register_setting_layers(QUERY_ONLY_STATIC_LAYERS, 0, true);
+	register_setting_layers(DEDICATED_AREA_LAYERS, 0, true);
+
+	register_setting_enum(
+		JOB_SYSTEM,
+		JOB_SYSTEM_WORKER_POOL,
+		"Worker Thread Pool,Dedicated Threads",
+		true
+	);
+
+	register_setting_ranged(DEDICATED_THREAD_COUNT, -1, U"-1,64,or_greater", true);
 }
 
 bool JoltProjectSettings::is_sleep_enabled() {
@@ -239,6 +272,11 @@ float JoltProjectSettings::get_kinematic_recovery_amount() {
 	return value;
 }
 
+int32_t JoltProjectSettings::get_collision_steps() {
+	static const auto value = get_setting<int32_t>(COLLISION_STEPS);
+	return value;
+}
+
 int32_t JoltProjectSettings::get_velocity_iterations() {
 	static const auto value = get_setting<int32_t>(VELOCITY_ITERATIONS);
 	return value;
@@ -312,6 +350,26 @@ int64_t JoltProjectSettings::get_max_temp_memory_b() {
 	return value;
 }
 
+uint32_t JoltProjectSettings::get_query_only_static_layers() {
+	static const auto value = (uint32_t)get_setting<int32_t>(QUERY_ONLY_STATIC_LAYERS);
+	return value;
+}
+
+uint32_t JoltProjectSettings::get_dedicated_area_layers() {
+	static const auto value = (uint32_t)get_setting<int32_t>(DEDICATED_AREA_LAYERS);
+	return value;
+}
+
+bool JoltProjectSettings::use_dedicated_job_threads() {
+	static const auto value = get_setting<int32_t>(JOB_SYSTEM) == JOB_SYSTEM_DEDICATED_THREADS;
+	return value;
+}
+
+int32_t JoltProjectSettings::get_dedicated_job_thread_count() {
+	static const auto value = get_setting<int32_t>(DEDICATED_THREAD_COUNT);
+	return value;
+}
+
 bool JoltProjectSettings::should_run_on_separate_thread() {
 	static const auto value = get_setting<bool>(RUN_ON_SEPARATE_THREAD);
 	return value;
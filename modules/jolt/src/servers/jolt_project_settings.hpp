@@ -30,6 +30,8 @@ public:
 
 	static float get_kinematic_recovery_amount();
 
+	static int32_t get_collision_steps();
+
 	static int32_t get_velocity_iterations();
 
 	static int32_t get_position_iterations();
@@ -58,6 +60,14 @@ public:
 
 	static int64_t get_max_temp_memory_b();
 
+	static uint32_t get_query_only_static_layers();
+
+	static uint32_t get_dedicated_area_layers();
+
+	static bool use_dedicated_job_threads();
+
+	static int32_t get_dedicated_job_thread_count();
+
 	static bool should_run_on_separate_thread();
 
 	static int32_t get_max_threads();
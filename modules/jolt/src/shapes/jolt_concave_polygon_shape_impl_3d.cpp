@@ -3,6 +3,19 @@
 #include "servers/jolt_project_settings.hpp"
 #include "shapes/jolt_custom_double_sided_shape.hpp"
 
+namespace {
+
+constexpr uint32_t CACHE_MAGIC = 0x4A434D53; // JCMS
+
+// `JPH_VERSION_ID` refers to `uint64` without qualifying it
+using JPH::uint64;
+
+// The binary state of a shape can differ between versions of Jolt, as well as between builds with
+// different features enabled, both of which are part of the version ID.
+constexpr uint64_t CACHE_VERSION = JPH_VERSION_ID;
+
+} // namespace
+
 Variant JoltConcavePolygonShapeImpl3D::get_data() const {
 	Dictionary data;
 	data["faces"] = faces;
@@ -27,15 +40,49 @@ void JoltConcavePolygonShapeImpl3D::set_data(const Variant& p_data) {
 	const Variant maybe_backface_collision = data.get("backface_collision", {});
 	ERR_FAIL_COND(maybe_backface_collision.get_type() != Variant::BOOL);
 
+	const Variant maybe_cache = data.get("physics_cache", PackedByteArray());
+	ERR_FAIL_COND(maybe_cache.get_type() != Variant::PACKED_BYTE_ARRAY);
+
 	faces = maybe_faces;
 	backface_collision = maybe_backface_collision;
+	cache = maybe_cache;
 }
 
 String JoltConcavePolygonShapeImpl3D::to_string() const {
 	return vformat("{vertex_count=%d}", faces.size());
 }
 
+PackedByteArray JoltConcavePolygonShapeImpl3D::bake_cache() const {
+	PackedByteArray bytes;
+
+	const JPH::ShapeRefC shape = _build_mesh();
+	QUIET_FAIL_NULL_D(shape);
+
+	JoltByteStreamOut stream(bytes);
+	stream.Write(CACHE_MAGIC);
+	stream.Write(CACHE_VERSION);
+	stream.Write(_calculate_cache_hash());
+
+	shape->SaveBinaryState(stream);
+
+	return bytes;
+}
+
 JPH::ShapeRefC JoltConcavePolygonShapeImpl3D::_build() const {
+	JPH::ShapeRefC shape = _restore_mesh();
+
+	if (shape == nullptr) {
+		shape = _build_mesh();
+	}
+
+	if (shape != nullptr && backface_collision) {
+		return _build_double_sided(shape);
+	}
+
+	return shape;
+}
+
+JPH::ShapeRefC JoltConcavePolygonShapeImpl3D::_build_mesh() const {
 	const auto vertex_count = (int32_t)faces.size();
 	const int32_t face_count = vertex_count / 3;
 	const int32_t excess_vertex_count = vertex_count % 3;
@@ -99,13 +146,53 @@ JPH::ShapeRefC JoltConcavePolygonShapeImpl3D::_build() const {
 		)
 	);
 
-	JPH::ShapeRefC shape = shape_result.Get();
+	return shape_result.Get();
+}
+
+JPH::ShapeRefC JoltConcavePolygonShapeImpl3D::_restore_mesh() const {
+	if (cache.is_empty()) {
+		return nullptr;
+	}
+
+	JoltByteStreamIn stream(cache);
 
-	if (backface_collision) {
-		return _build_double_sided(shape);
+	uint32_t magic = 0;
+	uint64_t version = 0;
+	uint32_t hash = 0;
+
+	stream.Read(magic);
+	stream.Read(version);
+	stream.Read(hash);
+
+	// The cache is only valid for the exact faces and settings it was baked with, using the same
+	// version of Jolt, otherwise we fall back to building the shape from scratch.
+	if (stream.IsFailed() || magic != CACHE_MAGIC || version != CACHE_VERSION ||
+		hash != _calculate_cache_hash())
+	{
+		return nullptr;
 	}
 
-	return shape;
+	const JPH::Shape::ShapeResult shape_result = JPH::Shape::sRestoreFromBinaryState(stream);
+
+	ERR_FAIL_COND_D_MSG(
+		shape_result.HasError() || stream.IsFailed(),
+		vformat(
+			"Godot Jolt failed to restore physics cache of concave polygon shape with %s. "
+			"It returned the following error: '%s'. "
+			"This shape belongs to %s.",
+			to_string(),
+			to_godot(shape_result.GetError()),
+			_owners_to_string()
+		)
+	);
+
+	return shape_result.Get();
+}
+
+uint32_t JoltConcavePolygonShapeImpl3D::_calculate_cache_hash() const {
+	uint32_t hash = hash_murmur3_buffer(faces.ptr(), (int)(faces.size() * sizeof(Vector3)));
+	hash = hash_murmur3_one_float(JoltProjectSettings::get_active_edge_threshold(), hash);
+	return hash_fmix32(hash);
 }
 
 JPH::ShapeRefC JoltConcavePolygonShapeImpl3D::_build_double_sided(const JPH::Shape* p_shape) const {
@@ -18,12 +18,22 @@ public:
 
 	String to_string() const;
 
+	PackedByteArray bake_cache() const;
+
 private:
 	JPH::ShapeRefC _build() const override;
 
+	JPH::ShapeRefC _build_mesh() const;
+
+	JPH::ShapeRefC _restore_mesh() const;
+
+	uint32_t _calculate_cache_hash() const;
+
 	JPH::ShapeRefC _build_double_sided(const JPH::Shape* p_shape) const;
 
 	PackedVector3Array faces;
 
+	PackedByteArray cache;
+
 	bool backface_collision = false;
 };
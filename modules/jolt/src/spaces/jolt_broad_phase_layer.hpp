@@ -7,9 +7,18 @@ constexpr JPH::BroadPhaseLayer BODY_STATIC(0);
 constexpr JPH::BroadPhaseLayer BODY_DYNAMIC(1);
 constexpr JPH::BroadPhaseLayer AREA_DETECTABLE(2);
 constexpr JPH::BroadPhaseLayer AREA_UNDETECTABLE(3);
+constexpr JPH::BroadPhaseLayer BODY_STATIC_QUERY_ONLY(4);
+constexpr JPH::BroadPhaseLayer AREA_DETECTABLE_DEDICATED(5);
+constexpr JPH::BroadPhaseLayer AREA_UNDETECTABLE_DEDICATED(6);
 
-constexpr uint32_t COUNT = 4;
+constexpr uint32_t COUNT = 7;
 
 static_assert(COUNT <= 8);
 
+// Whether an object on `p_collision_layer` belongs exclusively to `p_layers`, which is what decides
+// if it gets moved into one of the dedicated broad phase layers above.
+constexpr bool is_exclusive_to(uint32_t p_collision_layer, uint32_t p_layers) {
+	return p_collision_layer != 0 && (p_collision_layer & ~p_layers) == 0;
+}
+
 } // namespace JoltBroadPhaseLayer
@@ -6,6 +6,28 @@
 #include "servers/jolt_project_settings.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
+namespace {
+
+std::atomic<uint64_t> next_listener_id = 1;
+
+} // namespace
+
+void JoltContactListener3D::ThreadBuffer::clear() {
+	manifolds.clear();
+	contacts.clear();
+	overlap_events.clear();
+}
+
+JoltContactListener3D::JoltContactListener3D(JoltSpace3D* p_space)
+	: space(p_space)
+	, listener_id(next_listener_id++) { }
+
+JoltContactListener3D::~JoltContactListener3D() {
+	for (ThreadBuffer* buffer : thread_buffers) {
+		delete_safely(buffer);
+	}
+}
+
 void JoltContactListener3D::listen_for(JoltShapedObjectImpl3D* p_object) {
 	listening_for.insert(p_object->get_jolt_id());
 }
@@ -13,16 +35,33 @@ void JoltContactListener3D::listen_for(JoltShapedObjectImpl3D* p_object) {
 void JoltContactListener3D::pre_step() {
 	listening_for.clear();
 
+	collision_step = 0;
+
 #ifdef GDJ_CONFIG_EDITOR
 	debug_contact_count = 0;
 #endif // GDJ_CONFIG_EDITOR
 }
 
 void JoltContactListener3D::post_step() {
+	_merge_area_overlaps();
 	_flush_contacts();
 	_flush_area_shifts();
 	_flush_area_exits();
 	_flush_area_enters();
+
+	for (ThreadBuffer* buffer : thread_buffers) {
+		buffer->clear();
+	}
+}
+
+void JoltContactListener3D::state_restored() {
+	// Contacts involving areas aren't part of the saved state, so we exit all the overlaps that we
+	// know of, and let the next step enter them again if they're still overlapping.
+	for (const JPH::SubShapeIDPair& shape_pair : area_overlaps) {
+		area_exits.insert(shape_pair);
+	}
+
+	area_overlaps.clear();
 }
 
 void JoltContactListener3D::OnContactAdded(
@@ -58,9 +97,19 @@ void JoltContactListener3D::OnContactPersisted(
 }
 
 void JoltContactListener3D::OnContactRemoved(const JPH::SubShapeIDPair& p_shape_pair) {
-	if (!_try_remove_contacts(p_shape_pair)) {
-		_try_remove_area_overlap(p_shape_pair);
-	}
+	OverlapEvent& event = _get_thread_buffer().overlap_events.emplace_back();
+	event.shape_pair = p_shape_pair;
+	event.collision_step = collision_step.load(std::memory_order_relaxed);
+	event.removed = true;
+}
+
+void JoltContactListener3D::OnStep(
+	[[maybe_unused]] float p_step,
+	[[maybe_unused]] JPH::PhysicsSystem& p_physics_system
+) {
+	// This runs before any of the collision step's contact callbacks, and the job system makes
+	// sure those callbacks can't start before it's done.
+	collision_step.fetch_add(1, std::memory_order_relaxed);
 }
 
 JPH::SoftBodyValidateResult JoltContactListener3D::OnSoftBodyContactValidate(
@@ -84,6 +133,46 @@ void JoltContactListener3D::OnSoftBodyContactAdded(
 
 #endif // GDJ_CONFIG_EDITOR
 
+JoltContactListener3D::ThreadBuffer& JoltContactListener3D::_get_thread_buffer() {
+	struct CachedBuffer {
+		uint64_t listener_id = 0;
+
+		ThreadBuffer* buffer = nullptr;
+	};
+
+	// Every thread remembers the last buffer it wrote to, which means the mutex only needs to be
+	// taken when a thread switches between spaces, rather than for every contact.
+	static thread_local CachedBuffer cached_buffer;
+
+	if (cached_buffer.listener_id == listener_id) {
+		return *cached_buffer.buffer;
+	}
+
+	const std::thread::id thread_id = std::this_thread::get_id();
+
+	const MutexLock thread_buffers_lock(thread_buffers_mutex);
+
+	ThreadBuffer* buffer = nullptr;
+
+	for (ThreadBuffer* thread_buffer : thread_buffers) {
+		if (thread_buffer->thread_id == thread_id) {
+			buffer = thread_buffer;
+			break;
+		}
+	}
+
+	if (buffer == nullptr) {
+		buffer = new ThreadBuffer();
+		buffer->thread_id = thread_id;
+		thread_buffers.push_back(buffer);
+	}
+
+	cached_buffer.listener_id = listener_id;
+	cached_buffer.buffer = buffer;
+
+	return *buffer;
+}
+
 bool JoltContactListener3D::_is_listening_for(const JPH::Body& p_body) const {
 	return listening_for.has(p_body.GetID());
 }
@@ -221,17 +310,22 @@ bool JoltContactListener3D::_try_add_contacts(
 		p_manifold.mSubShapeID2
 	);
 
-	auto& manifold = [&]() -> Manifold& {
-		const MutexLock write_lock(write_mutex);
-		return manifolds_by_shape_pair[shape_pair];
-	}();
+	ThreadBuffer& buffer = _get_thread_buffer();
 
 	const JPH::uint contact_count = p_manifold.mRelativeContactPointsOn1.size();
 
-	manifold.contacts1.reserve((int32_t)contact_count);
-	manifold.contacts2.reserve((int32_t)contact_count);
+	Manifold& manifold = buffer.manifolds.emplace_back();
+	manifold.shape_pair = shape_pair;
+	manifold.collision_step = collision_step.load(std::memory_order_relaxed);
+	manifold.contact_offset = buffer.contacts.size();
+	manifold.contact_count = (int32_t)contact_count;
 	manifold.depth = p_manifold.mPenetrationDepth;
 
+	buffer.contacts.resize(manifold.contact_offset + manifold.contact_count * 2);
+
+	Contact* contacts1 = buffer.contacts.ptr() + manifold.contact_offset;
+	Contact* contacts2 = contacts1 + contact_count;
+
 	JPH::CollisionEstimationResult collision;
 
 	JPH::EstimateCollisionResponse(
@@ -246,8 +340,8 @@ bool JoltContactListener3D::_try_add_contacts(
 	);
 
 	for (JPH::uint i = 0; i < contact_count; ++i) {
-		Contact& contact1 = manifold.contacts1.emplace_back();
-		Contact& contact2 = manifold.contacts2.emplace_back();
+		Contact& contact1 = contacts1[i];
+		Contact& contact2 = contacts2[i];
 
 		const auto relative_point1 = JPH::RVec3(p_manifold.mRelativeContactPointsOn1[i]);
 		const auto relative_point2 = JPH::RVec3(p_manifold.mRelativeContactPointsOn2[i]);
@@ -292,19 +386,15 @@ bool JoltContactListener3D::_try_evaluate_area_overlap(
 		return false;
 	}
 
-	auto evaluate = [&](auto&& p_area, auto&& p_object, const JPH::SubShapeIDPair& p_shape_pair) {
-		const MutexLock write_lock(write_mutex);
+	ThreadBuffer& buffer = _get_thread_buffer();
 
-		if (p_area.can_monitor(p_object)) {
-			if (!area_overlaps.has(p_shape_pair)) {
-				area_overlaps.insert(p_shape_pair);
-				area_enters.insert(p_shape_pair);
-			}
-		} else {
-			if (area_overlaps.erase(p_shape_pair)) {
-				area_exits.insert(p_shape_pair);
-			}
-		}
+	const int32_t current_collision_step = collision_step.load(std::memory_order_relaxed);
+
+	auto evaluate = [&](auto&& p_area, auto&& p_object, const JPH::SubShapeIDPair& p_shape_pair) {
+		OverlapEvent& event = buffer.overlap_events.emplace_back();
+		event.shape_pair = p_shape_pair;
+		event.collision_step = current_collision_step;
+		event.can_monitor = p_area.can_monitor(p_object);
 	};
 
 	const JPH::SubShapeIDPair shape_pair1(
@@ -342,37 +432,6 @@ bool JoltContactListener3D::_try_evaluate_area_overlap(
 	return true;
 }
 
-bool JoltContactListener3D::_try_remove_contacts(const JPH::SubShapeIDPair& p_shape_pair) {
-	const MutexLock write_lock(write_mutex);
-
-	return manifolds_by_shape_pair.erase(p_shape_pair);
-}
-
-bool JoltContactListener3D::_try_remove_area_overlap(const JPH::SubShapeIDPair& p_shape_pair) {
-	const JPH::SubShapeIDPair swapped_shape_pair(
-		p_shape_pair.GetBody2ID(),
-		p_shape_pair.GetSubShapeID2(),
-		p_shape_pair.GetBody1ID(),
-		p_shape_pair.GetSubShapeID1()
-	);
-
-	const MutexLock write_lock(write_mutex);
-
-	bool removed = false;
-
-	if (area_overlaps.erase(p_shape_pair)) {
-		area_exits.insert(p_shape_pair);
-		removed = true;
-	}
-
-	if (area_overlaps.erase(swapped_shape_pair)) {
-		area_exits.insert(swapped_shape_pair);
-		removed = true;
-	}
-
-	return removed;
-}
-
 #ifdef GDJ_CONFIG_EDITOR
 
 bool JoltContactListener3D::_try_add_debug_contacts(
@@ -469,8 +528,112 @@ bool JoltContactListener3D::_try_add_debug_contacts(
 
 #endif // GDJ_CONFIG_EDITOR
 
+void JoltContactListener3D::_merge_area_overlaps() {
+	merged_overlap_events.clear();
+
+	for (const ThreadBuffer* buffer : thread_buffers) {
+		for (const OverlapEvent& event : buffer->overlap_events) {
+			if (!event.removed) {
+				merged_overlap_events.push_back(event);
+				continue;
+			}
+
+			// Removals don't know which of the two bodies is the area, so they apply to both
+			// orderings of the shape pair.
+			OverlapEvent& swapped_event = merged_overlap_events.emplace_back(event);
+			swapped_event.shape_pair = JPH::SubShapeIDPair(
+				event.shape_pair.GetBody2ID(),
+				event.shape_pair.GetSubShapeID2(),
+				event.shape_pair.GetBody1ID(),
+				event.shape_pair.GetSubShapeID1()
+			);
+
+			merged_overlap_events.push_back(event);
+		}
+	}
+
+	// The order in which the buffers were filled depends on how the narrow phase was
+	// distributed across the job threads, so we sort everything by shape pair in order for the
+	// resulting enter/exit events to be deterministic. Within a collision step Jolt only reports
+	// removals after all the contacts have been added or persisted, so these go last.
+	merged_overlap_events.sort([](const OverlapEvent& p_lhs, const OverlapEvent& p_rhs) {
+		if (p_lhs.shape_pair == p_rhs.shape_pair) {
+			if (p_lhs.collision_step != p_rhs.collision_step) {
+				return p_lhs.collision_step < p_rhs.collision_step;
+			}
+
+			return !p_lhs.removed && p_rhs.removed;
+		}
+
+		return p_lhs.shape_pair < p_rhs.shape_pair;
+	});
+
+	// Only the last event of each shape pair matters, since an overlap that was removed in one
+	// collision step and added back in the next one never actually stopped overlapping.
+	const auto event_count = (int32_t)merged_overlap_events.size();
+
+	for (int32_t i = 0; i < event_count; ++i) {
+		const OverlapEvent& event = merged_overlap_events[i];
+
+		if (i + 1 < event_count && merged_overlap_events[i + 1].shape_pair == event.shape_pair) {
+			continue;
+		}
+
+		const JPH::SubShapeIDPair& shape_pair = event.shape_pair;
+
+		if (!event.removed && event.can_monitor) {
+			if (!area_overlaps.has(shape_pair)) {
+				area_overlaps.insert(shape_pair);
+				area_enters.insert(shape_pair);
+			}
+		} else {
+			if (area_overlaps.erase(shape_pair)) {
+				area_exits.insert(shape_pair);
+			}
+		}
+	}
+}
+
 void JoltContactListener3D::_flush_contacts() {
-	for (auto&& [shape_pair, manifold] : manifolds_by_shape_pair) {
+	merged_manifolds.clear();
+
+	for (const ThreadBuffer* buffer : thread_buffers) {
+		for (const Manifold& manifold : buffer->manifolds) {
+			MergedManifold& merged_manifold = merged_manifolds.emplace_back();
+			merged_manifold.manifold = &manifold;
+			merged_manifold.buffer = buffer;
+		}
+	}
+
+	// Bodies only keep a limited number of contacts, so the order in which they're added matters.
+	merged_manifolds.sort([](const MergedManifold& p_lhs, const MergedManifold& p_rhs) {
+		const Manifold& lhs = *p_lhs.manifold;
+		const Manifold& rhs = *p_rhs.manifold;
+
+		if (lhs.shape_pair == rhs.shape_pair) {
+			return lhs.collision_step < rhs.collision_step;
+		}
+
+		return lhs.shape_pair < rhs.shape_pair;
+	});
+
+	const auto manifold_count = (int32_t)merged_manifolds.size();
+
+	for (int32_t manifold_index = 0; manifold_index < manifold_count; ++manifold_index) {
+		const MergedManifold& merged_manifold = merged_manifolds[manifold_index];
+		const Manifold& manifold = *merged_manifold.manifold;
+		const JPH::SubShapeIDPair& shape_pair = manifold.shape_pair;
+
+		// A shape pair gets reported once per collision step, of which we only want the latest.
+		if (manifold_index + 1 < manifold_count &&
+			merged_manifolds[manifold_index + 1].manifold->shape_pair == shape_pair)
+		{
+			continue;
+		}
+
+		const Contact* contacts1 = merged_manifold.buffer->contacts.ptr() + manifold.contact_offset;
+		const Contact* contacts2 = contacts1 + manifold.contact_count;
+
 		const JPH::BodyID body_ids[] = {shape_pair.GetBody1ID(), shape_pair.GetBody2ID()};
 
 		const JoltReadableBodies3D jolt_bodies = space->read_bodies(body_ids, count_of(body_ids));
@@ -484,7 +647,9 @@ void JoltContactListener3D::_flush_contacts() {
 		const int32_t shape_index1 = body1->find_shape_index(shape_pair.GetSubShapeID1());
 		const int32_t shape_index2 = body2->find_shape_index(shape_pair.GetSubShapeID2());
 
-		for (const Contact& contact : manifold.contacts1) {
+		for (int32_t i = 0; i < manifold.contact_count; ++i) {
+			const Contact& contact = contacts1[i];
+
 			body1->add_contact(
 				body2,
 				manifold.depth,
@@ -499,7 +664,9 @@ void JoltContactListener3D::_flush_contacts() {
 			);
 		}
 
-		for (const Contact& contact : manifold.contacts2) {
+		for (int32_t i = 0; i < manifold.contact_count; ++i) {
+			const Contact& contact = contacts2[i];
+
 			body2->add_contact(
 				body1,
 				manifold.depth,
@@ -513,9 +680,6 @@ void JoltContactListener3D::_flush_contacts() {
 				to_godot(contact.impulse)
 			);
 		}
-
-		manifold.contacts1.clear();
-		manifold.contacts2.clear();
 	}
 }
 
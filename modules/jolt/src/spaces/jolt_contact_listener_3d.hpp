@@ -5,7 +5,8 @@ class JoltSpace3D;
 
 class JoltContactListener3D final
 	: public JPH::ContactListener
-	, public JPH::SoftBodyContactListener {
+	, public JPH::SoftBodyContactListener
+	, public JPH::PhysicsStepListener {
 	using Mutex = std::mutex;
 
 	using MutexLock = std::unique_lock<Mutex>;
@@ -42,23 +43,62 @@ class JoltContactListener3D final
 
 	using Contacts = LocalVectorJolt<Contact>;
 
+	// The contacts of a manifold are stored in the owning thread buffer's `contacts`, starting at
+	// `contact_offset`, with the contacts as seen from the first body followed by the contacts as
+	// seen from the second body.
 	struct Manifold {
-		Contacts contacts1;
+		JPH::SubShapeIDPair shape_pair;
 
-		Contacts contacts2;
+		int32_t collision_step = 0;
+
+		int32_t contact_offset = 0;
+
+		int32_t contact_count = 0;
 
 		float depth = 0.0f;
 	};
 
+	// Either an evaluation of an added/persisted contact involving an area, or a contact removal,
+	// tagged with the collision step it happened in, since a single step can consist of several.
+	struct OverlapEvent {
+		JPH::SubShapeIDPair shape_pair;
+
+		int32_t collision_step = 0;
+
+		bool removed = false;
+
+		bool can_monitor = false;
+	};
+
+	// Everything reported by Jolt's narrow phase gets written to one of these, one per thread, so
+	// that the job threads don't need to synchronize with each other. They're merged in a
+	// deterministic order on the main thread once the step has finished.
+	struct alignas(JPH_CACHE_LINE_SIZE) ThreadBuffer {
+		void clear();
+
+		LocalVectorJolt<Manifold> manifolds;
+
+		Contacts contacts;
+
+		LocalVectorJolt<OverlapEvent> overlap_events;
+
+		std::thread::id thread_id;
+	};
+
+	struct MergedManifold {
+		const Manifold* manifold = nullptr;
+
+		const ThreadBuffer* buffer = nullptr;
+	};
+
 	using BodyIDs = HashSetJolt<JPH::BodyID, BodyIDHasher>;
 
 	using Overlaps = HashSetJolt<JPH::SubShapeIDPair, ShapePairHasher>;
 
-	using ManifoldsByShapePair = HashMapJolt<JPH::SubShapeIDPair, Manifold, ShapePairHasher>;
-
 public:
-	explicit JoltContactListener3D(JoltSpace3D* p_space)
-		: space(p_space) { }
+	explicit JoltContactListener3D(JoltSpace3D* p_space);
+
+	~JoltContactListener3D() override;
 
 	void listen_for(JoltShapedObjectImpl3D* p_object);
 
@@ -66,6 +106,8 @@ public:
 
 	void post_step();
 
+	void state_restored();
+
 #ifdef GDJ_CONFIG_EDITOR
 	const PackedVector3Array& get_debug_contacts() const { return debug_contacts; }
 
@@ -93,6 +135,8 @@ private:
 
 	void OnContactRemoved(const JPH::SubShapeIDPair& p_shape_pair) override;
 
+	void OnStep(float p_step, JPH::PhysicsSystem& p_physics_system) override;
+
 	JPH::SoftBodyValidateResult OnSoftBodyContactValidate(
 		const JPH::Body& p_soft_body,
 		const JPH::Body& p_other_body,
@@ -106,6 +150,8 @@ private:
 	) override;
 #endif // GDJ_CONFIG_EDITOR
 
+	ThreadBuffer& _get_thread_buffer();
+
 	bool _is_listening_for(const JPH::Body& p_body) const;
 
 	bool _try_override_collision_response(
@@ -139,10 +185,6 @@ private:
 		const JPH::ContactManifold& p_manifold
 	);
 
-	bool _try_remove_contacts(const JPH::SubShapeIDPair& p_shape_pair);
-
-	bool _try_remove_area_overlap(const JPH::SubShapeIDPair& p_shape_pair);
-
 #ifdef GDJ_CONFIG_EDITOR
 	bool _try_add_debug_contacts(
 		const JPH::Body& p_body1,
@@ -156,6 +198,8 @@ private:
 	);
 #endif // GDJ_CONFIG_EDITOR
 
+	void _merge_area_overlaps();
+
 	void _flush_contacts();
 
 	void _flush_area_enters();
@@ -164,7 +208,11 @@ private:
 
 	void _flush_area_exits();
 
-	ManifoldsByShapePair manifolds_by_shape_pair;
+	LocalVectorJolt<ThreadBuffer*> thread_buffers;
+
+	LocalVectorJolt<MergedManifold> merged_manifolds;
+
+	LocalVectorJolt<OverlapEvent> merged_overlap_events;
 
 	BodyIDs listening_for;
 
@@ -174,10 +222,14 @@ private:
 
 	Overlaps area_exits;
 
-	Mutex write_mutex;
+	Mutex thread_buffers_mutex;
 
 	JoltSpace3D* space = nullptr;
 
+	uint64_t listener_id = 0;
+
+	std::atomic<int32_t> collision_step = 0;
+
 #ifdef GDJ_CONFIG_EDITOR
 	PackedVector3Array debug_contacts;
 
@@ -28,11 +28,43 @@ public:
 		allow_collision(AREA_UNDETECTABLE, BODY_DYNAMIC);
 		allow_collision(AREA_UNDETECTABLE, AREA_DETECTABLE);
 
+		// The dedicated area layers behave exactly like their regular counterparts, they only exist
+		// to keep large sets of areas out of the regular area trees.
+		allow_collision(BODY_DYNAMIC, AREA_DETECTABLE_DEDICATED);
+		allow_collision(BODY_DYNAMIC, AREA_UNDETECTABLE_DEDICATED);
+
+		allow_collision(AREA_DETECTABLE, AREA_DETECTABLE_DEDICATED);
+		allow_collision(AREA_DETECTABLE, AREA_UNDETECTABLE_DEDICATED);
+		allow_collision(AREA_UNDETECTABLE, AREA_DETECTABLE_DEDICATED);
+
+		allow_collision(AREA_DETECTABLE_DEDICATED, BODY_DYNAMIC);
+		allow_collision(AREA_DETECTABLE_DEDICATED, AREA_DETECTABLE);
+		allow_collision(AREA_DETECTABLE_DEDICATED, AREA_UNDETECTABLE);
+		allow_collision(AREA_DETECTABLE_DEDICATED, AREA_DETECTABLE_DEDICATED);
+		allow_collision(AREA_DETECTABLE_DEDICATED, AREA_UNDETECTABLE_DEDICATED);
+
+		allow_collision(AREA_UNDETECTABLE_DEDICATED, BODY_DYNAMIC);
+		allow_collision(AREA_UNDETECTABLE_DEDICATED, AREA_DETECTABLE);
+		allow_collision(AREA_UNDETECTABLE_DEDICATED, AREA_DETECTABLE_DEDICATED);
+
+		// Query-only static bodies are never paired with anything during the simulation step, except
+		// for areas if those are allowed to detect static bodies, so they're only found by queries.
 		if (JoltProjectSettings::areas_detect_static_bodies()) {
-			allow_collision(BODY_STATIC, AREA_DETECTABLE);
-			allow_collision(BODY_STATIC, AREA_UNDETECTABLE);
-			allow_collision(AREA_DETECTABLE, BODY_STATIC);
-			allow_collision(AREA_UNDETECTABLE, BODY_STATIC);
+			const LayerType static_layers[] = {BODY_STATIC, BODY_STATIC_QUERY_ONLY};
+
+			const LayerType area_layers[] = {
+				AREA_DETECTABLE,
+				AREA_UNDETECTABLE,
+				AREA_DETECTABLE_DEDICATED,
+				AREA_UNDETECTABLE_DEDICATED
+			};
+
+			for (const LayerType static_layer : static_layers) {
+				for (const LayerType area_layer : area_layers) {
+					allow_collision(static_layer, area_layer);
+					allow_collision(area_layer, static_layer);
+				}
+			}
 		}
 	}
 
@@ -170,6 +202,15 @@ const char* JoltLayerMapper::GetBroadPhaseLayerName(JPH::BroadPhaseLayer p_layer
 		case (JPH::BroadPhaseLayer::Type)JoltBroadPhaseLayer::AREA_UNDETECTABLE: {
 			return "AREA_UNDETECTABLE";
 		}
+		case (JPH::BroadPhaseLayer::Type)JoltBroadPhaseLayer::BODY_STATIC_QUERY_ONLY: {
+			return "BODY_STATIC_QUERY_ONLY";
+		}
+		case (JPH::BroadPhaseLayer::Type)JoltBroadPhaseLayer::AREA_DETECTABLE_DEDICATED: {
+			return "AREA_DETECTABLE_DEDICATED";
+		}
+		case (JPH::BroadPhaseLayer::Type)JoltBroadPhaseLayer::AREA_UNDETECTABLE_DEDICATED: {
+			return "AREA_UNDETECTABLE_DEDICATED";
+		}
 		default: {
 			return "UNKNOWN";
 		}
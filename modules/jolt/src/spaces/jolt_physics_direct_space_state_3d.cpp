@@ -38,6 +38,17 @@ bool JoltPhysicsDirectSpaceState3D::_intersect_ray(
 		p_pick_ray
 	);
 
+	return query_ray(p_from, p_to, query_filter, p_hit_from_inside, p_hit_back_faces, p_result);
+}
+
+bool JoltPhysicsDirectSpaceState3D::query_ray(
+	const Vector3& p_from,
+	const Vector3& p_to,
+	const JoltQueryFilter3D& p_filter,
+	bool p_hit_from_inside,
+	bool p_hit_back_faces,
+	PhysicsServer3DExtensionRayResult* p_result
+) const {
 	const JPH::RVec3 from = to_jolt_r(p_from);
 	const JPH::RVec3 to = to_jolt_r(p_to);
 	const auto vector = JPH::Vec3(to - from);
@@ -52,7 +63,7 @@ bool JoltPhysicsDirectSpaceState3D::_intersect_ray(
 	JoltQueryCollectorClosest<JPH::CastRayCollector> collector;
 
 	space->get_narrow_phase_query()
-		.CastRay(ray, settings, collector, query_filter, query_filter, query_filter);
+		.CastRay(ray, settings, collector, p_filter, p_filter, p_filter);
 
 	if (!collector.had_hit()) {
 		return false;
@@ -165,33 +176,55 @@ int32_t JoltPhysicsDirectSpaceState3D::_intersect_shape(
 	const JPH::ShapeRefC jolt_shape = shape->try_build();
 	ERR_FAIL_NULL_D(jolt_shape);
 
+	const JoltQueryFilter3D
+		query_filter(*this, p_collision_mask, p_collide_with_bodies, p_collide_with_areas);
+
+	return query_shape(
+		*jolt_shape,
+		p_transform,
+		(float)p_margin,
+		query_filter,
+		p_results,
+		p_max_results
+	);
+}
+
+int32_t JoltPhysicsDirectSpaceState3D::query_shape(
+	const JPH::Shape& p_jolt_shape,
+	const Transform3D& p_transform,
+	float p_margin,
+	const JoltQueryFilter3D& p_filter,
+	PhysicsServer3DExtensionShapeResult* p_results,
+	int32_t p_max_results
+) const {
+	if (p_max_results == 0) {
+		return 0;
+	}
+
 	Vector3 scale;
 	const Transform3D transform = MathEx::decomposed(p_transform, scale);
-	const Vector3 com_scaled = to_godot(jolt_shape->GetCenterOfMass());
+	const Vector3 com_scaled = to_godot(p_jolt_shape.GetCenterOfMass());
 	const Transform3D transform_com = transform.translated_local(com_scaled);
 
 	JPH::CollideShapeSettings settings;
-	settings.mMaxSeparationDistance = (float)p_margin;
+	settings.mMaxSeparationDistance = p_margin;
 
 	if (JoltProjectSettings::use_enhanced_edge_removal()) {
 		settings.mCollectFacesMode = JPH::ECollectFacesMode::CollectFaces;
 	}
 
-	const JoltQueryFilter3D
-		query_filter(*this, p_collision_mask, p_collide_with_bodies, p_collide_with_areas);
-
 	JoltQueryCollectorAnyMultiNoEdges<32> collector(p_max_results);
 
 	space->get_narrow_phase_query().CollideShape(
-		jolt_shape,
+		&p_jolt_shape,
 		to_jolt(scale),
 		to_jolt_r(transform_com),
 		settings,
 		to_jolt_r(transform_com.origin),
 		collector,
-		query_filter,
-		query_filter,
-		query_filter
+		p_filter,
+		p_filter,
+		p_filter
 	);
 
 	collector.finish();
@@ -249,37 +282,57 @@ bool JoltPhysicsDirectSpaceState3D::_cast_motion(
 	const JPH::ShapeRefC jolt_shape = shape->try_build();
 	ERR_FAIL_NULL_D(jolt_shape);
 
+	const JoltQueryFilter3D
+		query_filter(*this, p_collision_mask, p_collide_with_bodies, p_collide_with_areas);
+
+	query_motion(
+		*jolt_shape,
+		p_transform,
+		p_motion,
+		(float)p_margin,
+		query_filter,
+		*p_closest_safe,
+		*p_closest_unsafe
+	);
+
+	return true;
+}
+
+void JoltPhysicsDirectSpaceState3D::query_motion(
+	const JPH::Shape& p_jolt_shape,
+	const Transform3D& p_transform,
+	const Vector3& p_motion,
+	float p_margin,
+	const JoltQueryFilter3D& p_filter,
+	real_t& p_closest_safe,
+	real_t& p_closest_unsafe
+) const {
 	Vector3 scale;
 	const Transform3D transform = MathEx::decomposed(p_transform, scale);
-	const Vector3 com_scaled = to_godot(jolt_shape->GetCenterOfMass());
+	const Vector3 com_scaled = to_godot(p_jolt_shape.GetCenterOfMass());
 	Transform3D transform_com = transform.translated_local(com_scaled);
 
 	JPH::CollideShapeSettings settings;
-	settings.mMaxSeparationDistance = (float)p_margin;
+	settings.mMaxSeparationDistance = p_margin;
 
 	if (JoltProjectSettings::use_enhanced_edge_removal()) {
 		settings.mCollectFacesMode = JPH::ECollectFacesMode::CollectFaces;
 	}
 
-	const JoltQueryFilter3D
-		query_filter(*this, p_collision_mask, p_collide_with_bodies, p_collide_with_areas);
-
 	_cast_motion_impl(
-		*jolt_shape,
+		p_jolt_shape,
 		transform_com,
 		scale,
 		p_motion,
 		true,
 		settings,
-		query_filter,
-		query_filter,
-		query_filter,
+		p_filter,
+		p_filter,
+		p_filter,
 		JPH::ShapeFilter(),
-		*p_closest_safe,
-		*p_closest_unsafe
+		p_closest_safe,
+		p_closest_unsafe
 	);
-
-	return true;
 }
 
 bool JoltPhysicsDirectSpaceState3D::_collide_shape(
@@ -5,6 +5,7 @@
 #if defined(GDEXTENSION) || defined(GDMODULE_IMPL)
 
 class JoltBodyImpl3D;
+class JoltQueryFilter3D;
 class JoltShapeImpl3D;
 class JoltSpace3D;
 
@@ -103,6 +104,38 @@ public:
 		PhysicsServer3DExtensionMotionResult* p_result
 	) const;
 
+	// These are the same as their underscored counterparts, but take a filter and a Jolt shape
+	// directly, which lets callers that query often set those up once and reuse them, rather than
+	// having to go through a `Shape3D` and an exclusion set for every query.
+
+	bool query_ray(
+		const Vector3& p_from,
+		const Vector3& p_to,
+		const JoltQueryFilter3D& p_filter,
+		bool p_hit_from_inside,
+		bool p_hit_back_faces,
+		PhysicsServer3DExtensionRayResult* p_result
+	) const;
+
+	int32_t query_shape(
+		const JPH::Shape& p_jolt_shape,
+		const Transform3D& p_transform,
+		float p_margin,
+		const JoltQueryFilter3D& p_filter,
+		PhysicsServer3DExtensionShapeResult* p_results,
+		int32_t p_max_results
+	) const;
+
+	void query_motion(
+		const JPH::Shape& p_jolt_shape,
+		const Transform3D& p_transform,
+		const Vector3& p_motion,
+		float p_margin,
+		const JoltQueryFilter3D& p_filter,
+		real_t& p_closest_safe,
+		real_t& p_closest_unsafe
+	) const;
+
 	JoltSpace3D& get_space() const { return *space; }
 
 #ifndef GDEXTENSION
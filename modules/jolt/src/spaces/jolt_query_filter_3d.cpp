@@ -1,6 +1,7 @@
 #include "jolt_query_filter_3d.hpp"
 
 #include "objects/jolt_object_impl_3d.hpp"
+#include "servers/jolt_project_settings.hpp"
 #include "spaces/jolt_broad_phase_layer.hpp"
 #include "spaces/jolt_physics_direct_space_state_3d.hpp"
 #include "spaces/jolt_space_3d.hpp"
@@ -31,6 +32,17 @@ bool JoltQueryFilter3D::ShouldCollide(JPH::BroadPhaseLayer p_broad_phase_layer)
 		case (JPH::BroadPhaseLayer::Type)JoltBroadPhaseLayer::AREA_UNDETECTABLE: {
 			return collide_with_areas;
 		} break;
+		// Everything in the dedicated layers is exclusive to the layers configured for them, which
+		// lets us skip walking those trees entirely when the mask can't match anything in them.
+		case (JPH::BroadPhaseLayer::Type)JoltBroadPhaseLayer::BODY_STATIC_QUERY_ONLY: {
+			return collide_with_bodies &&
+				(collision_mask & JoltProjectSettings::get_query_only_static_layers()) != 0;
+		} break;
+		case (JPH::BroadPhaseLayer::Type)JoltBroadPhaseLayer::AREA_DETECTABLE_DEDICATED:
+		case (JPH::BroadPhaseLayer::Type)JoltBroadPhaseLayer::AREA_UNDETECTABLE_DEDICATED: {
+			return collide_with_areas &&
+				(collision_mask & JoltProjectSettings::get_dedicated_area_layers()) != 0;
+		} break;
 		default: {
 			ERR_FAIL_D_MSG(vformat("Unhandled broad phase layer: '%d'", broad_phase_layer));
 		}
@@ -52,8 +64,18 @@ bool JoltQueryFilter3D::ShouldCollide(JPH::ObjectLayer p_object_layer) const {
 	return (collision_mask & object_collision_layer) != 0;
 }
 
-bool JoltQueryFilter3D::ShouldCollide([[maybe_unused]] const JPH::BodyID& p_body_id) const {
-	return true;
+bool JoltQueryFilter3D::ShouldCollide(const JPH::BodyID& p_body_id) const {
+	if (excluded_bodies.is_empty()) {
+		return true;
+	}
+
+	return !std::binary_search(excluded_bodies.begin(), excluded_bodies.end(), p_body_id);
+}
+
+void JoltQueryFilter3D::exclude_body(const JPH::BodyID& p_body_id) {
+	if (!std::binary_search(excluded_bodies.begin(), excluded_bodies.end(), p_body_id)) {
+		excluded_bodies.ordered_insert(p_body_id);
+	}
 }
 
 bool JoltQueryFilter3D::ShouldCollideLocked(const JPH::Body& p_body) const {
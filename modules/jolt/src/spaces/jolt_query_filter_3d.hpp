@@ -24,7 +24,17 @@ public:
 
 	bool ShouldCollideLocked(const JPH::Body& p_body) const override;
 
+	void set_collision_mask(uint32_t p_mask) { collision_mask = p_mask; }
+
+	void exclude_body(const JPH::BodyID& p_body_id);
+
+	void clear_excluded_bodies() { excluded_bodies.clear(); }
+
 private:
+	// Kept sorted, so that a filter can be built once and reused across many queries, without
+	// having to go through the object to check for exclusions like `is_body_excluded_from_query`.
+	InlineVector<JPH::BodyID, 4> excluded_bodies;
+
 	const JoltPhysicsDirectSpaceState3D& space_state;
 
 	const JoltSpace3D& space;
@@ -21,6 +21,36 @@ constexpr double DEFAULT_SLEEP_THRESHOLD_LINEAR = 0.1;
 constexpr double DEFAULT_SLEEP_THRESHOLD_ANGULAR = 8.0 * Math_PI / 180;
 constexpr double DEFAULT_SOLVER_ITERATIONS = 8;
 
+constexpr uint32_t STATE_MAGIC = 0x4A535453; // JSTS
+
+// Static bodies and areas are left out of the saved state, since their transforms are owned by
+// their nodes rather than the simulation. Contacts involving areas are left out as well, so that
+// their overlaps get reported again after restoring, rather than silently going missing.
+class JoltStateRecorderFilter final : public JPH::StateRecorderFilter {
+public:
+	explicit JoltStateRecorderFilter(const JPH::BodyLockInterface& p_lock_iface)
+		: lock_iface(p_lock_iface) { }
+
+	static bool should_save(const JPH::Body& p_body) {
+		return !p_body.IsStatic() && !p_body.IsSensor();
+	}
+
+	bool ShouldSaveBody(const JPH::Body& p_body) const override { return should_save(p_body); }
+
+	bool ShouldSaveContact(const JPH::BodyID& p_body_id1, const JPH::BodyID& p_body_id2)
+		const override {
+		return !_is_sensor(p_body_id1) && !_is_sensor(p_body_id2);
+	}
+
+private:
+	bool _is_sensor(const JPH::BodyID& p_body_id) const {
+		const JPH::BodyLockRead lock(lock_iface, p_body_id);
+		return lock.Succeeded() && lock.GetBody().IsSensor();
+	}
+
+	const JPH::BodyLockInterface& lock_iface;
+};
+
 } // namespace
 
 JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
@@ -29,7 +59,8 @@ JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
 	, temp_allocator(new JoltTempAllocator())
 	, layer_mapper(new JoltLayerMapper())
 	, contact_listener(new JoltContactListener3D(this))
-	, physics_system(new JPH::PhysicsSystem()) {
+	, physics_system(new JPH::PhysicsSystem())
+	, collision_steps(JoltProjectSettings::get_collision_steps()) {
 	physics_system->Init(
 		(JPH::uint)JoltProjectSettings::get_max_bodies(),
 		0,
@@ -57,6 +88,7 @@ JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
 	physics_system->SetGravity(JPH::Vec3::sZero());
 	physics_system->SetContactListener(contact_listener);
 	physics_system->SetSoftBodyContactListener(contact_listener);
+	physics_system->AddStepListener(contact_listener);
 
 	physics_system->SetCombineFriction(
 		[](const JPH::Body& p_body1,
@@ -99,11 +131,20 @@ JoltSpace3D::~JoltSpace3D() {
 
 void JoltSpace3D::step(float p_step) {
 	last_step = p_step;
+	last_collision_steps = collision_steps;
+
+	++step_count;
 
 	_pre_step(p_step);
 
-	const JPH::EPhysicsUpdateError
-		update_error = physics_system->Update(p_step, 1, temp_allocator, job_system);
+	// Each collision step runs the full collision detection and solver for a fraction of the step,
+	// which lets fast-moving bodies be simulated more accurately without raising the tick rate.
+	const JPH::EPhysicsUpdateError update_error = physics_system->Update(
+		p_step,
+		collision_steps,
+		temp_allocator,
+		job_system
+	);
 
 	if ((update_error & JPH::EPhysicsUpdateError::ManifoldCacheFull) !=
 		JPH::EPhysicsUpdateError::None)
@@ -143,6 +184,82 @@ void JoltSpace3D::step(float p_step) {
 	has_stepped = true;
 }
 
+void JoltSpace3D::set_collision_steps(int32_t p_steps) {
+	ERR_FAIL_COND_MSG(
+		p_steps < 1,
+		vformat("Invalid number of collision steps: '%d'. It must be at least 1.", p_steps)
+	);
+
+	collision_steps = p_steps;
+}
+
+PackedByteArray JoltSpace3D::save_state() {
+	PackedByteArray state;
+	JoltByteStateRecorder recorder(state);
+
+	recorder.Write(STATE_MAGIC);
+	recorder.Write(_hash_state_bodies());
+
+	const JoltStateRecorderFilter filter(physics_system->GetBodyLockInterfaceNoLock());
+	physics_system->SaveState(recorder, JPH::EStateRecorderState::All, &filter);
+
+	return state;
+}
+
+bool JoltSpace3D::restore_state(const PackedByteArray& p_state) {
+	PackedByteArray state = p_state;
+	JoltByteStateRecorder recorder(state);
+
+	uint32_t magic = 0;
+	uint32_t bodies_hash = 0;
+
+	recorder.Read(magic);
+	recorder.Read(bodies_hash);
+
+	ERR_FAIL_COND_V_MSG(
+		recorder.IsFailed() || magic != STATE_MAGIC,
+		false,
+		"Failed to restore physics space state. The state is not valid."
+	);
+
+	// Jolt can only restore the state of bodies that still exist, and gives up halfway through if
+	// any of them don't, so we make sure that the set of bodies is the same before touching anything.
+	ERR_FAIL_COND_V_MSG(
+		bodies_hash != _hash_state_bodies(),
+		false,
+		"Failed to restore physics space state. "
+		"Bodies have been added to or removed from the space since the state was saved."
+	);
+
+	ERR_FAIL_COND_V_MSG(
+		!physics_system->RestoreState(recorder) || recorder.IsFailed(),
+		false,
+		"Failed to restore physics space state. The state is not valid."
+	);
+
+	contact_listener->state_restored();
+
+	body_accessor.acquire_all();
+
+	const int32_t body_count = body_accessor.get_count();
+
+	for (int32_t i = 0; i < body_count; ++i) {
+		if (const JPH::Body* jolt_body = body_accessor.try_get(i)) {
+			if (!JoltStateRecorderFilter::should_save(*jolt_body) || jolt_body->IsSoftBody()) {
+				continue;
+			}
+
+			if (auto* body = reinterpret_cast<JoltBodyImpl3D*>(jolt_body->GetUserData())) {
+				body->state_restored(*jolt_body);
+			}
+		}
+	}
+
+	body_accessor.release();
+
+	return true;
+}
+
 void JoltSpace3D::call_queries() {
 	if (!has_stepped) {
 		// HACK(mihe): We need to skip the first invocation of this method, because there will be
@@ -153,33 +270,23 @@ void JoltSpace3D::call_queries() {
 		return;
 	}
 
-	body_accessor.acquire_all();
-
-	const int32_t body_count = body_accessor.get_count();
-
-	for (int32_t i = 0; i < body_count; ++i) {
-		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			if (!jolt_body->IsSensor() && !jolt_body->IsSoftBody()) {
-				auto* body = reinterpret_cast<JoltBodyImpl3D*>(jolt_body->GetUserData());
-				if (!body) {
-					continue;
-				}
-				body->call_queries(*jolt_body);
-			}
+	// We iterate by index and re-read the size on every iteration, since the callbacks
+	// invoked here are free to enqueue or dequeue objects while we're flushing the queues.
+	for (int32_t i = 0; i < body_call_queries_queue.size(); ++i) {
+		if (JoltBodyImpl3D* body = body_call_queries_queue[i]) {
+			body->call_queries();
 		}
 	}
 
-	for (int32_t i = 0; i < body_count; ++i) {
-		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			if (jolt_body->IsSensor()) {
-				auto* area = reinterpret_cast<JoltAreaImpl3D*>(jolt_body->GetUserData());
+	body_call_queries_queue.clear();
 
-				area->call_queries(*jolt_body);
-			}
+	for (int32_t i = 0; i < area_call_queries_queue.size(); ++i) {
+		if (JoltAreaImpl3D* area = area_call_queries_queue[i]) {
+			area->call_queries();
 		}
 	}
 
-	body_accessor.release();
+	area_call_queries_queue.clear();
 }
 
 double JoltSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
@@ -381,6 +488,50 @@ void JoltSpace3D::remove_joint(JoltJointImpl3D* p_joint) {
 	remove_joint(p_joint->get_jolt_ref());
 }
 
+void JoltSpace3D::add_pre_step_body(JoltBodyImpl3D* p_body) {
+	pre_step_bodies.push_back(p_body);
+}
+
+void JoltSpace3D::remove_pre_step_body(JoltBodyImpl3D* p_body) {
+	pre_step_bodies.erase(p_body);
+}
+
+void JoltSpace3D::enqueue_call_queries(JoltBodyImpl3D* p_body) {
+	body_call_queries_queue.push_back(p_body);
+}
+
+void JoltSpace3D::enqueue_call_queries(JoltAreaImpl3D* p_area) {
+	area_call_queries_queue.push_back(p_area);
+}
+
+void JoltSpace3D::dequeue_call_queries(JoltBodyImpl3D* p_body) {
+	for (JoltBodyImpl3D*& body : body_call_queries_queue) {
+		if (body == p_body) {
+			body = nullptr;
+		}
+	}
+}
+
+void JoltSpace3D::dequeue_call_queries(JoltAreaImpl3D* p_area) {
+	for (JoltAreaImpl3D*& area : area_call_queries_queue) {
+		if (area == p_area) {
+			area = nullptr;
+		}
+	}
+}
+
+void JoltSpace3D::enqueue_shapes_changed(JoltShapedObjectImpl3D* p_object) {
+	shapes_changed_queue.push_back(p_object);
+}
+
+void JoltSpace3D::dequeue_shapes_changed(JoltShapedObjectImpl3D* p_object) {
+	for (JoltShapedObjectImpl3D*& object : shapes_changed_queue) {
+		if (object == p_object) {
+			object = nullptr;
+		}
+	}
+}
+
 #ifdef GDJ_CONFIG_EDITOR
 
 void JoltSpace3D::dump_debug_snapshot(const String& p_dir) {
@@ -463,28 +614,58 @@ void JoltSpace3D::set_max_debug_contacts(int32_t p_count) {
 #endif // GDJ_CONFIG_EDITOR
 
 void JoltSpace3D::_pre_step(float p_step) {
-	body_accessor.acquire_all();
-
 	contact_listener->pre_step();
 
-	const int32_t body_count = body_accessor.get_count();
+	// Sleeping rigid bodies have nothing to do in their pre-step, so we only visit the active ones,
+	// with the exception of the bodies in `pre_step_bodies`, which are visited separately below.
+	body_accessor.acquire_active();
 
-	for (int32_t i = 0; i < body_count; ++i) {
+	const int32_t active_count = body_accessor.get_count();
+
+	for (int32_t i = 0; i < active_count; ++i) {
 		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			if (jolt_body->IsSoftBody()) {
+			if (jolt_body->IsSensor() || jolt_body->IsSoftBody()) {
 				continue;
 			}
 
-			auto* object = reinterpret_cast<JoltShapedObjectImpl3D*>(jolt_body->GetUserData());
+			auto* body = reinterpret_cast<JoltBodyImpl3D*>(jolt_body->GetUserData());
+
+			if (body == nullptr || body->is_pre_step_tracked()) {
+				continue;
+			}
+
+			body->pre_step(p_step, *jolt_body);
+		}
+	}
+
+	body_accessor.release();
+
+	if (pre_step_bodies.is_empty()) {
+		return;
+	}
+
+	pre_step_body_ids.clear();
+
+	for (const JoltBodyImpl3D* body : pre_step_bodies) {
+		pre_step_body_ids.push_back(body->get_jolt_id());
+	}
 
-			if (!object) {
+	body_accessor.acquire(pre_step_body_ids.ptr(), pre_step_body_ids.size());
+
+	const int32_t tracked_count = body_accessor.get_count();
+
+	for (int32_t i = 0; i < tracked_count; ++i) {
+		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
+			auto* body = reinterpret_cast<JoltBodyImpl3D*>(jolt_body->GetUserData());
+
+			if (body == nullptr) {
 				continue;
 			}
 
-			object->pre_step(p_step, *jolt_body);
+			body->pre_step(p_step, *jolt_body);
 
-			if (object->reports_contacts()) {
-				contact_listener->listen_for(object);
+			if (body->reports_contacts()) {
+				contact_listener->listen_for(body);
 			}
 		}
 	}
@@ -492,26 +673,34 @@ void JoltSpace3D::_pre_step(float p_step) {
 	body_accessor.release();
 }
 
-void JoltSpace3D::_post_step(float p_step) {
-	body_accessor.acquire_all();
+uint32_t JoltSpace3D::_hash_state_bodies() {
+	uint32_t hash = HASH_MURMUR3_SEED;
 
-	contact_listener->post_step();
+	body_accessor.acquire_all();
 
 	const int32_t body_count = body_accessor.get_count();
 
 	for (int32_t i = 0; i < body_count; ++i) {
-		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			if (jolt_body->IsSoftBody()) {
-				continue;
-			}
-
-			auto* object = reinterpret_cast<JoltObjectImpl3D*>(jolt_body->GetUserData());
-			if (!object) {
-				continue;
+		if (const JPH::Body* jolt_body = body_accessor.try_get(i)) {
+			if (JoltStateRecorderFilter::should_save(*jolt_body)) {
+				hash = hash_murmur3_one_32(jolt_body->GetID().GetIndexAndSequenceNumber(), hash);
 			}
-			object->post_step(p_step, *jolt_body);
 		}
 	}
 
 	body_accessor.release();
+
+	return hash_fmix32(hash);
+}
+
+void JoltSpace3D::_post_step(float p_step) {
+	contact_listener->post_step();
+
+	for (JoltShapedObjectImpl3D* object : shapes_changed_queue) {
+		if (object != nullptr) {
+			object->post_step(p_step);
+		}
+	}
+
+	shapes_changed_queue.clear();
 }
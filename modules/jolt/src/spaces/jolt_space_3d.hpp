@@ -3,11 +3,13 @@
 #include "spaces/jolt_body_accessor_3d.hpp"
 
 class JoltAreaImpl3D;
+class JoltBodyImpl3D;
 class JoltContactListener3D;
 class JoltJointImpl3D;
 class JoltLayerMapper;
 class JoltObjectImpl3D;
 class JoltPhysicsDirectSpaceState3D;
+class JoltShapedObjectImpl3D;
 
 class JoltSpace3D final {
 public:
@@ -72,6 +74,20 @@ public:
 
 	float get_last_step() const { return last_step; }
 
+	// The length of each of the collision steps that made up the last step, which is what things
+	// like constraint impulses are relative to.
+	float get_last_collision_step() const { return last_step / (float)last_collision_steps; }
+
+	int32_t get_collision_steps() const { return collision_steps; }
+
+	void set_collision_steps(int32_t p_steps);
+
+	uint64_t get_step_count() const { return step_count; }
+
+	PackedByteArray save_state();
+
+	bool restore_state(const PackedByteArray& p_state);
+
 	void add_joint(JPH::Constraint* p_jolt_ref);
 
 	void add_joint(JoltJointImpl3D* p_joint);
@@ -80,6 +96,22 @@ public:
 
 	void remove_joint(JoltJointImpl3D* p_joint);
 
+	void add_pre_step_body(JoltBodyImpl3D* p_body);
+
+	void remove_pre_step_body(JoltBodyImpl3D* p_body);
+
+	void enqueue_call_queries(JoltBodyImpl3D* p_body);
+
+	void enqueue_call_queries(JoltAreaImpl3D* p_area);
+
+	void dequeue_call_queries(JoltBodyImpl3D* p_body);
+
+	void dequeue_call_queries(JoltAreaImpl3D* p_area);
+
+	void enqueue_shapes_changed(JoltShapedObjectImpl3D* p_object);
+
+	void dequeue_shapes_changed(JoltShapedObjectImpl3D* p_object);
+
 #ifdef GDJ_CONFIG_EDITOR
 	void dump_debug_snapshot(const String& p_dir);
 
@@ -97,8 +129,24 @@ private:
 
 	void _post_step(float p_step);
 
+	uint32_t _hash_state_bodies();
+
 	JoltBodyWriter3D body_accessor;
 
+	// Bodies that need to be pre-stepped even when sleeping, meaning kinematic bodies and bodies
+	// that report contacts, which are skipped when iterating over the active bodies.
+	LocalVectorJolt<JoltBodyImpl3D*> pre_step_bodies;
+
+	LocalVectorJolt<JPH::BodyID> pre_step_body_ids;
+
+	// Entries in these queues are set to null rather than removed when dequeued, since
+	// the callbacks invoked while flushing them can end up removing objects from the space.
+	LocalVectorJolt<JoltBodyImpl3D*> body_call_queries_queue;
+
+	LocalVectorJolt<JoltAreaImpl3D*> area_call_queries_queue;
+
+	LocalVectorJolt<JoltShapedObjectImpl3D*> shapes_changed_queue;
+
 	RID rid;
 
 	JPH::JobSystem* job_system = nullptr;
@@ -115,7 +163,13 @@ private:
 
 	JoltAreaImpl3D* default_area = nullptr;
 
+	uint64_t step_count = 0;
+
 	float last_step = 0.0f;
 
+	int32_t collision_steps = 1;
+
+	int32_t last_collision_steps = 1;
+
 	bool has_stepped = false;
 };
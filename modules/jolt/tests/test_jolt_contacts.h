@@ -0,0 +1,101 @@
+/**************************************************************************/
+/*  test_jolt_contacts.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                               SWANSONG                                 */
+/*                          https://eirteam.moe                           */
+/**************************************************************************/
+/* Copyright (c) 2023-present Álex Román Núñez (EIRTeam).                 */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_JOLT_CONTACTS_H
+#define TEST_JOLT_CONTACTS_H
+
+#include "servers/physics_server_3d.h"
+#include "tests/test_macros.h"
+
+namespace TestJoltContacts {
+
+// Steps a box resting on a floor and returns how many contacts the box had reported to it.
+static int get_resting_contact_count(PhysicsServer3D *p_server, int32_t p_collision_steps) {
+	const RID space = p_server->space_create();
+	p_server->space_set_active(space, true);
+	p_server->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY, 9.8);
+	p_server->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY_VECTOR, Vector3(0, -1, 0));
+	p_server->call("space_set_collision_steps", space, p_collision_steps);
+
+	const RID floor_shape = p_server->box_shape_create();
+	p_server->shape_set_data(floor_shape, Vector3(20, 1, 20));
+
+	const RID floor = p_server->body_create();
+	p_server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	p_server->body_add_shape(floor, floor_shape);
+	p_server->body_set_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, -1, 0)));
+	p_server->body_set_space(floor, space);
+
+	const RID box_shape = p_server->box_shape_create();
+	p_server->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	const RID box = p_server->body_create();
+	p_server->body_set_mode(box, PhysicsServer3D::BODY_MODE_RIGID);
+	p_server->body_add_shape(box, box_shape);
+	p_server->body_set_max_contacts_reported(box, 16);
+	// Sleeping bodies don't report contacts.
+	p_server->body_set_state(box, PhysicsServer3D::BODY_STATE_CAN_SLEEP, false);
+	p_server->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, 0.5, 0)));
+	p_server->body_set_space(box, space);
+
+	for (int i = 0; i < 30; i++) {
+		p_server->step(1.0 / 60.0);
+		p_server->flush_queries();
+	}
+
+	const int contact_count = p_server->body_get_direct_state(box)->get_contact_count();
+
+	p_server->free(box);
+	p_server->free(box_shape);
+	p_server->free(floor);
+	p_server->free(floor_shape);
+	p_server->free(space);
+
+	return contact_count;
+}
+
+TEST_CASE("[JoltPhysics] Collision steps don't report the same contacts more than once") {
+	PhysicsServer3D *server = PhysicsServer3DManager::get_singleton()->new_server("JoltPhysics3D");
+	REQUIRE_MESSAGE(server != nullptr, "The Jolt physics server should be registered.");
+
+	server->init();
+
+	const int single_step_count = get_resting_contact_count(server, 1);
+	const int double_step_count = get_resting_contact_count(server, 2);
+
+	CHECK_MESSAGE(single_step_count > 0, "The resting box should be touching the floor.");
+	CHECK_MESSAGE(double_step_count == single_step_count, "Every collision step reports the same contacts, only the latest ones should be kept.");
+
+	server->finish();
+	memdelete(server);
+}
+
+} // namespace TestJoltContacts
+
+#endif // TEST_JOLT_CONTACTS_H
@@ -0,0 +1,140 @@
+/**************************************************************************/
+/*  test_jolt_space_state.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                               SWANSONG                                 */
+/*                          https://eirteam.moe                           */
+/**************************************************************************/
+/* Copyright (c) 2023-present Álex Román Núñez (EIRTeam).                 */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_JOLT_SPACE_STATE_H
+#define TEST_JOLT_SPACE_STATE_H
+
+#include "servers/physics_server_3d.h"
+#include "tests/test_macros.h"
+
+namespace TestJoltSpaceState {
+
+constexpr double STEP = 1.0 / 60.0;
+
+constexpr int32_t BOX_COUNT = 8;
+
+static void step(PhysicsServer3D* p_server, int32_t p_steps) {
+	for (int32_t i = 0; i < p_steps; ++i) {
+		p_server->step(STEP);
+		p_server->flush_queries();
+	}
+}
+
+static Vector<Transform3D> get_transforms(PhysicsServer3D* p_server, const Vector<RID>& p_bodies) {
+	Vector<Transform3D> transforms;
+
+	for (const RID& body : p_bodies) {
+		transforms.push_back(p_server->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM));
+	}
+
+	return transforms;
+}
+
+TEST_CASE("[JoltPhysics] Restoring a saved space state reproduces the same simulation") {
+	PhysicsServer3D* server = PhysicsServer3DManager::get_singleton()->new_server("JoltPhysics3D");
+	REQUIRE_MESSAGE(server != nullptr, "The Jolt physics server should be registered.");
+
+	server->init();
+
+	const RID space = server->space_create();
+	server->space_set_active(space, true);
+	server->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY, 9.8);
+	server->area_set_param(space, PhysicsServer3D::AREA_PARAM_GRAVITY_VECTOR, Vector3(0, -1, 0));
+
+	const RID floor_shape = server->box_shape_create();
+	server->shape_set_data(floor_shape, Vector3(20, 1, 20));
+
+	const RID floor = server->body_create();
+	server->body_set_mode(floor, PhysicsServer3D::BODY_MODE_STATIC);
+	server->body_add_shape(floor, floor_shape);
+	server->body_set_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, -1, 0)));
+	server->body_set_space(floor, space);
+
+	const RID box_shape = server->box_shape_create();
+	server->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	Vector<RID> boxes;
+
+	// Stacked slightly off-center, so that the boxes tumble and keep colliding with each other.
+	for (int32_t i = 0; i < BOX_COUNT; ++i) {
+		const RID box = server->body_create();
+		server->body_set_mode(box, PhysicsServer3D::BODY_MODE_RIGID);
+		server->body_add_shape(box, box_shape);
+		server->body_set_state(box, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(Vector3(0, 1, 0), 0.3 * i), Vector3(0.2 * (i % 3), 0.5 + 1.1 * i, 0.15 * (i % 2))));
+		server->body_set_space(box, space);
+		boxes.push_back(box);
+	}
+
+	step(server, 30);
+
+	const Vector<Transform3D> saved_transforms = get_transforms(server, boxes);
+	const PackedByteArray state = server->call("space_save_state", space);
+	CHECK_FALSE(state.is_empty());
+
+	step(server, 60);
+	const Vector<Transform3D> first_run = get_transforms(server, boxes);
+
+	CHECK(bool(server->call("space_restore_state", space, state)));
+	CHECK_MESSAGE(get_transforms(server, boxes) == saved_transforms, "Restoring should put the bodies back where they were.");
+
+	step(server, 60);
+	const Vector<Transform3D> second_run = get_transforms(server, boxes);
+
+	CHECK_MESSAGE(first_run != saved_transforms, "The boxes should have moved after being saved.");
+	CHECK_MESSAGE(first_run == second_run, "Stepping from the restored state should give the exact same result.");
+
+	// Restoring into a space whose bodies don't match the saved state should fail without changes.
+	const RID extra_box = server->body_create();
+	server->body_set_mode(extra_box, PhysicsServer3D::BODY_MODE_RIGID);
+	server->body_add_shape(extra_box, box_shape);
+	server->body_set_space(extra_box, space);
+
+	ERR_PRINT_OFF;
+	CHECK_FALSE(bool(server->call("space_restore_state", space, state)));
+	ERR_PRINT_ON;
+	CHECK(get_transforms(server, boxes) == second_run);
+
+	server->free(extra_box);
+
+	for (const RID& box : boxes) {
+		server->free(box);
+	}
+
+	server->free(box_shape);
+	server->free(floor);
+	server->free(floor_shape);
+	server->free(space);
+
+	server->finish();
+	memdelete(server);
+}
+
+} // namespace TestJoltSpaceState
+
+#endif // TEST_JOLT_SPACE_STATE_H
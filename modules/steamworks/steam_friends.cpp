@@ -100,11 +100,11 @@ bool HBSteamFriend::request_user_information(bool p_include_avatars) const {
 }
 
 HBSteamFriend::HBSteamFriend() {
-	Steamworks::get_singleton()->add_callback(PersonaStateChange_t::k_iCallback, callable_mp(this, &HBSteamFriend::_on_persona_state_change));
+	Steamworks::get_singleton()->add_native_callback<HBSteamFriend, &HBSteamFriend::_on_persona_state_change>(PersonaStateChange_t::k_iCallback, this);
 }
 
-void HBSteamFriend::_on_persona_state_change(Ref<SteamworksCallbackData> p_callback) {
-	const PersonaStateChange_t *state_change = p_callback->get_data<PersonaStateChange_t>();
+void HBSteamFriend::_on_persona_state_change(const SteamworksCallbackData &p_callback, bool p_io_failure) {
+	const PersonaStateChange_t *state_change = p_callback.get_data<PersonaStateChange_t>();
 	if (state_change->m_ulSteamID == steam_id) {
 		if (state_change->m_nChangeFlags & k_EPersonaChangeAvatar) {
 			avatar.unref();
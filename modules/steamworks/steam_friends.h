@@ -45,7 +45,7 @@ private:
 	Ref<Texture2D> avatar;
 	uint64_t steam_id;
 	static HashMap<uint64_t, Ref<WeakRef>> friend_cache;
-	void _on_persona_state_change(Ref<SteamworksCallbackData> p_callback);
+	void _on_persona_state_change(const SteamworksCallbackData &p_callback, bool p_io_failure);
 
 protected:
 	static void _bind_methods();
@@ -72,7 +72,7 @@ void HBSteamLobby::_on_lobby_entered(Ref<SteamworksCallbackData> p_callback_data
 	const LobbyEnter_t *lobby_enter = p_callback_data->get_data<LobbyEnter_t>();
 	if (lobby_enter->m_ulSteamIDLobby == lobby_id) {
 		emit_signal("lobby_entered", lobby_enter->m_EChatRoomEnterResponse == k_EChatRoomEnterResponseSuccess);
-		Steamworks::get_singleton()->add_callback(LobbyChatMsg_t::k_iCallback, callable_mp(this, &HBSteamLobby::_on_lobby_chat_msg));
+		Steamworks::get_singleton()->add_native_callback<HBSteamLobby, &HBSteamLobby::_on_lobby_chat_msg>(LobbyChatMsg_t::k_iCallback, this);
 	}
 }
 
@@ -82,8 +82,8 @@ void HBSteamLobby::_on_lobby_created(Ref<SteamworksCallbackData> p_callback_data
 	emit_signal("lobby_created", (SWC::Result)lobby_created->m_eResult);
 }
 
-void HBSteamLobby::_on_lobby_chat_msg(Ref<SteamworksCallbackData> p_callback_data) {
-	const LobbyChatMsg_t *msg = p_callback_data->get_data<LobbyChatMsg_t>();
+void HBSteamLobby::_on_lobby_chat_msg(const SteamworksCallbackData &p_callback_data, bool p_io_failure) {
+	const LobbyChatMsg_t *msg = p_callback_data.get_data<LobbyChatMsg_t>();
 	if (msg->m_ulSteamIDLobby != lobby_id) {
 		return;
 	}
@@ -105,8 +105,8 @@ void HBSteamLobby::_on_lobby_chat_msg(Ref<SteamworksCallbackData> p_callback_dat
 	}
 }
 
-void HBSteamLobby::_on_lobby_data_updated(Ref<SteamworksCallbackData> p_callback_data) {
-	LobbyDataUpdate_t *update = (LobbyDataUpdate_t *)p_callback_data->get_data<LobbyDataUpdate_t>();
+void HBSteamLobby::_on_lobby_data_updated(const SteamworksCallbackData &p_callback_data, bool p_io_failure) {
+	LobbyDataUpdate_t *update = (LobbyDataUpdate_t *)p_callback_data.get_data<LobbyDataUpdate_t>();
 	if (update->m_ulSteamIDLobby != lobby_id) {
 		return;
 	}
@@ -117,8 +117,8 @@ void HBSteamLobby::_on_lobby_data_updated(Ref<SteamworksCallbackData> p_callback
 	}
 }
 
-void HBSteamLobby::_on_lobby_chat_updated(Ref<SteamworksCallbackData> p_callback_data) {
-	LobbyChatUpdate_t *update = (LobbyChatUpdate_t *)p_callback_data->get_data<LobbyChatUpdate_t>();
+void HBSteamLobby::_on_lobby_chat_updated(const SteamworksCallbackData &p_callback_data, bool p_io_failure) {
+	LobbyChatUpdate_t *update = (LobbyChatUpdate_t *)p_callback_data.get_data<LobbyChatUpdate_t>();
 	if (update->m_ulSteamIDLobby != lobby_id) {
 		return;
 	}
@@ -247,8 +247,8 @@ void HBSteamLobby::leave_lobby() {
 HBSteamLobby::HBSteamLobby() {
 	// listen to global LobbyEnter_t callbacks since they might be triggered by lobby creation
 	Steamworks::get_singleton()->add_callback(LobbyEnter_t::k_iCallback, callable_mp(this, &HBSteamLobby::_on_lobby_entered).bind(false));
-	Steamworks::get_singleton()->add_callback(LobbyDataUpdate_t::k_iCallback, callable_mp(this, &HBSteamLobby::_on_lobby_data_updated));
-	Steamworks::get_singleton()->add_callback(LobbyChatUpdate_t::k_iCallback, callable_mp(this, &HBSteamLobby::_on_lobby_chat_updated));
+	Steamworks::get_singleton()->add_native_callback<HBSteamLobby, &HBSteamLobby::_on_lobby_data_updated>(LobbyDataUpdate_t::k_iCallback, this);
+	Steamworks::get_singleton()->add_native_callback<HBSteamLobby, &HBSteamLobby::_on_lobby_chat_updated>(LobbyChatUpdate_t::k_iCallback, this);
 }
 
 void HBLobbyListQuery::_bind_methods() {
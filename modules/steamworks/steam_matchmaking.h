@@ -47,9 +47,9 @@ private:
 	void _create_lobby(SteamworksConstants::LobbyType p_lobby_type, int p_max_members);
 	void _on_lobby_entered(Ref<SteamworksCallbackData> p_callback_data, bool p_io_failure);
 	void _on_lobby_created(Ref<SteamworksCallbackData> p_callback_data, bool p_io_failure);
-	void _on_lobby_chat_msg(Ref<SteamworksCallbackData> p_callback_data);
-	void _on_lobby_data_updated(Ref<SteamworksCallbackData> p_callback_data);
-	void _on_lobby_chat_updated(Ref<SteamworksCallbackData> p_callback_data);
+	void _on_lobby_chat_msg(const SteamworksCallbackData &p_callback_data, bool p_io_failure);
+	void _on_lobby_data_updated(const SteamworksCallbackData &p_callback_data, bool p_io_failure);
+	void _on_lobby_chat_updated(const SteamworksCallbackData &p_callback_data, bool p_io_failure);
 
 protected:
 	static void _bind_methods();
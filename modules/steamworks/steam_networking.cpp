@@ -33,14 +33,81 @@
 #include "steam_friends.h"
 #include "steamworks.h"
 
-void HBSteamNetworking::_on_p2p_connection_failed(Ref<SteamworksCallbackData> p_callback) {
-	const P2PSessionConnectFail_t *failure = p_callback->get_data<P2PSessionConnectFail_t>();
+class HBSteamNetworkingSteamBackend : public HBSteamNetworkingBackend {
+	ISteamNetworking *steam_networking = nullptr;
+
+public:
+	virtual bool is_packet_available(uint32_t *r_packet_size, int p_channel) override {
+		return SteamAPI_ISteamNetworking_IsP2PPacketAvailable(steam_networking, r_packet_size, p_channel);
+	}
+
+	virtual bool read_packet(uint8_t *r_data, uint32_t p_data_size, uint32_t *r_packet_size, uint64_t *r_sender_steam_id, int p_channel) override {
+		// I can't believe this is legal...
+		// CSteamID should be a structure that can be reinterpreted as a 64 bit int, which should be a Steam ID.
+		// damn valve using classes in the """FLAT""" API.
+		return SteamAPI_ISteamNetworking_ReadP2PPacket(steam_networking, r_data, p_data_size, r_packet_size, (CSteamID *)r_sender_steam_id, p_channel);
+	}
+
+	virtual bool send_packet(uint64_t p_target_steam_id, const uint8_t *p_data, uint32_t p_data_size, SWC::P2PSend p_send_type, int p_channel) override {
+		return SteamAPI_ISteamNetworking_SendP2PPacket(steam_networking, p_target_steam_id, p_data, p_data_size, (EP2PSend)p_send_type, p_channel);
+	}
+
+	HBSteamNetworkingSteamBackend(ISteamNetworking *p_steam_networking) :
+			steam_networking(p_steam_networking) {}
+};
+
+bool HBSteamNetworkingLoopbackBackend::is_packet_available(uint32_t *r_packet_size, int p_channel) {
+	const ChannelQueue *queue = channels.getptr(p_channel);
+	if (!queue || queue->read_position >= queue->packets.size()) {
+		return false;
+	}
+	*r_packet_size = queue->packets[queue->read_position].size;
+	return true;
+}
+
+bool HBSteamNetworkingLoopbackBackend::read_packet(uint8_t *r_data, uint32_t p_data_size, uint32_t *r_packet_size, uint64_t *r_sender_steam_id, int p_channel) {
+	ChannelQueue *queue = channels.getptr(p_channel);
+	if (!queue || queue->read_position >= queue->packets.size()) {
+		return false;
+	}
+	const PacketInfo &packet = queue->packets[queue->read_position];
+	ERR_FAIL_COND_V(p_data_size < packet.size, false);
+	memcpy(r_data, queue->data.ptr() + packet.offset, packet.size);
+	*r_packet_size = packet.size;
+	*r_sender_steam_id = packet.sender_steam_id;
+	queue->read_position++;
+	if (queue->read_position == queue->packets.size()) {
+		// Everything was consumed, rewind while keeping the allocated capacity.
+		queue->data.clear();
+		queue->packets.clear();
+		queue->read_position = 0;
+	}
+	return true;
+}
+
+bool HBSteamNetworkingLoopbackBackend::send_packet(uint64_t p_target_steam_id, const uint8_t *p_data, uint32_t p_data_size, SWC::P2PSend p_send_type, int p_channel) {
+	ChannelQueue *queue = channels.getptr(p_channel);
+	if (!queue) {
+		queue = &channels.insert(p_channel, ChannelQueue())->value;
+	}
+	PacketInfo packet;
+	packet.offset = queue->data.size();
+	packet.size = p_data_size;
+	packet.sender_steam_id = local_steam_id;
+	queue->data.resize(packet.offset + p_data_size);
+	memcpy(queue->data.ptr() + packet.offset, p_data, p_data_size);
+	queue->packets.push_back(packet);
+	return true;
+}
+
+void HBSteamNetworking::_on_p2p_connection_failed(const SteamworksCallbackData &p_callback, bool p_io_failure) {
+	const P2PSessionConnectFail_t *failure = p_callback.get_data<P2PSessionConnectFail_t>();
 	const uint64_t *steam_id = (uint64_t *)&failure->m_steamIDRemote;
 	emit_signal("p2p_connection_failed", HBSteamFriend::from_steam_id(*steam_id), failure->m_eP2PSessionError);
 }
 
-void HBSteamNetworking::_on_p2p_session_request(Ref<SteamworksCallbackData> p_callback) {
-	const P2PSessionRequest_t *request = p_callback->get_data<P2PSessionRequest_t>();
+void HBSteamNetworking::_on_p2p_session_request(const SteamworksCallbackData &p_callback, bool p_io_failure) {
+	const P2PSessionRequest_t *request = p_callback.get_data<P2PSessionRequest_t>();
 	const uint64_t *steam_id = (uint64_t *)&request->m_steamIDRemote;
 	emit_signal("p2p_session_requested", HBSteamFriend::from_steam_id(*steam_id));
 }
@@ -70,25 +137,24 @@ bool HBSteamNetworking::close_p2p_session_with_user(Ref<HBSteamFriend> p_user) {
 }
 
 bool HBSteamNetworking::is_p2p_packet_available(int p_channel) {
+	ERR_FAIL_NULL_V(backend, false);
 	uint32_t _packet_size;
-	return SteamAPI_ISteamNetworking_IsP2PPacketAvailable(steam_networking, &_packet_size, p_channel);
+	return backend->is_packet_available(&_packet_size, p_channel);
 }
 
 Ref<SteamP2PPacket> HBSteamNetworking::read_p2p_packet(int p_channel) {
+	ERR_FAIL_NULL_V(backend, Ref<SteamP2PPacket>());
 	uint32_t packet_size;
-	if (!SteamAPI_ISteamNetworking_IsP2PPacketAvailable(steam_networking, &packet_size, p_channel)) {
+	if (!backend->is_packet_available(&packet_size, p_channel)) {
 		return Ref<SteamP2PPacket>();
 	}
 
 	Vector<uint8_t> packet_data;
 	packet_data.resize(packet_size);
 
-	// I can't believe this is legal...
-	// CSteamID should be a structure that can be reinterpreted as a 64 bit int, which should be a Steam ID.
-	// damn valve using classes in the """FLAT""" API.
 	uint64_t sender_steam_id;
 
-	bool read_successful = SteamAPI_ISteamNetworking_ReadP2PPacket(steam_networking, packet_data.ptrw(), packet_data.size(), &packet_size, (CSteamID *)&sender_steam_id, p_channel);
+	bool read_successful = backend->read_packet(packet_data.ptrw(), packet_data.size(), &packet_size, &sender_steam_id, p_channel);
 	if (!read_successful) {
 		return Ref<SteamP2PPacket>();
 	}
@@ -96,17 +162,60 @@ Ref<SteamP2PPacket> HBSteamNetworking::read_p2p_packet(int p_channel) {
 	return memnew(SteamP2PPacket(packet_data, sender_steam_id));
 }
 
-bool HBSteamNetworking::send_p2p_packet(Ref<HBSteamFriend> p_target_user, Vector<uint8_t> p_data, SWC::P2PSend p_send_type, int p_channel) {
+bool HBSteamNetworking::send_p2p_packet(Ref<HBSteamFriend> p_target_user, const Vector<uint8_t> &p_data, SWC::P2PSend p_send_type, int p_channel) {
 	ERR_FAIL_COND_V_MSG(!p_target_user.is_valid(), false, "Given target user for P2P packet was invalid.");
-	ERR_FAIL_COND_V_MSG(p_data.size() == 0, false, "Given P2P packet data to send was empty.");
-	return SteamAPI_ISteamNetworking_SendP2PPacket(steam_networking, p_target_user->get_steam_id(), p_data.ptr(), p_data.size(), (EP2PSend)p_send_type, p_channel);
+	return send_p2p_packet_raw(p_target_user->get_steam_id(), p_data.ptr(), p_data.size(), p_send_type, p_channel);
+}
+
+int HBSteamNetworking::drain_p2p_packets(LocalVector<uint8_t> &r_buffer, LocalVector<P2PPacketInfo> &r_packets, int p_channel) {
+	ERR_FAIL_NULL_V(backend, 0);
+	int packet_count = 0;
+	uint32_t packet_size;
+	while (backend->is_packet_available(&packet_size, p_channel)) {
+		P2PPacketInfo info;
+		info.offset = r_buffer.size();
+		// LocalVector only reallocates when growing past its capacity.
+		r_buffer.resize(info.offset + packet_size);
+		if (!backend->read_packet(r_buffer.ptr() + info.offset, packet_size, &info.size, &info.sender_steam_id, p_channel)) {
+			r_buffer.resize(info.offset);
+			break;
+		}
+		r_buffer.resize(info.offset + info.size);
+		r_packets.push_back(info);
+		packet_count++;
+	}
+	return packet_count;
+}
+
+bool HBSteamNetworking::send_p2p_packet_raw(uint64_t p_target_steam_id, const uint8_t *p_data, uint32_t p_data_size, SWC::P2PSend p_send_type, int p_channel) {
+	ERR_FAIL_NULL_V(backend, false);
+	ERR_FAIL_COND_V_MSG(p_data_size == 0, false, "Given P2P packet data to send was empty.");
+	return backend->send_packet(p_target_steam_id, p_data, p_data_size, p_send_type, p_channel);
+}
+
+void HBSteamNetworking::set_backend(HBSteamNetworkingBackend *p_backend) {
+	if (owns_backend && backend) {
+		memdelete(backend);
+	}
+	backend = p_backend;
+	owns_backend = false;
 }
 
 void HBSteamNetworking::init_interface() {
 	steam_networking = SteamAPI_SteamNetworking();
+	if (!backend) {
+		backend = memnew(HBSteamNetworkingSteamBackend(steam_networking));
+		owns_backend = true;
+	}
 	Steamworks *sw = Steamworks::get_singleton();
-	sw->add_callback(P2PSessionConnectFail_t::k_iCallback, callable_mp(this, &HBSteamNetworking::_on_p2p_connection_failed));
-	sw->add_callback(P2PSessionRequest_t::k_iCallback, callable_mp(this, &HBSteamNetworking::_on_p2p_session_request));
+	sw->add_native_callback<HBSteamNetworking, &HBSteamNetworking::_on_p2p_connection_failed>(P2PSessionConnectFail_t::k_iCallback, this);
+	sw->add_native_callback<HBSteamNetworking, &HBSteamNetworking::_on_p2p_session_request>(P2PSessionRequest_t::k_iCallback, this);
+}
+
+HBSteamNetworking::~HBSteamNetworking() {
+	if (owns_backend && backend) {
+		memdelete(backend);
+	}
 }
 
 bool HBSteamNetworking::is_valid() const {
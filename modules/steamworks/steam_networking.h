@@ -32,6 +32,8 @@
 #define STEAM_NETWORKING_H
 
 #include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "steamworks_callback_data.h"
 #include "steamworks_constants.gen.h"
 
@@ -52,11 +54,48 @@ public:
 	SteamP2PPacket(Vector<uint8_t> p_data, uint64_t p_sender_steam_id);
 };
 
+// Transport used by HBSteamNetworking to move P2P packets, swappable so packet paths can run without Steam.
+class HBSteamNetworkingBackend {
+public:
+	virtual bool is_packet_available(uint32_t *r_packet_size, int p_channel) = 0;
+	virtual bool read_packet(uint8_t *r_data, uint32_t p_data_size, uint32_t *r_packet_size, uint64_t *r_sender_steam_id, int p_channel) = 0;
+	virtual bool send_packet(uint64_t p_target_steam_id, const uint8_t *p_data, uint32_t p_data_size, SWC::P2PSend p_send_type, int p_channel) = 0;
+	virtual ~HBSteamNetworkingBackend() {}
+};
+
+// Delivers every sent packet back to the local user, used for offline testing.
+class HBSteamNetworkingLoopbackBackend : public HBSteamNetworkingBackend {
+	struct PacketInfo {
+		uint32_t offset = 0;
+		uint32_t size = 0;
+		uint64_t sender_steam_id = 0;
+	};
+
+	struct ChannelQueue {
+		LocalVector<uint8_t> data;
+		LocalVector<PacketInfo> packets;
+		uint32_t read_position = 0;
+	};
+
+	HashMap<int, ChannelQueue> channels;
+	uint64_t local_steam_id = 0;
+
+public:
+	virtual bool is_packet_available(uint32_t *r_packet_size, int p_channel) override;
+	virtual bool read_packet(uint8_t *r_data, uint32_t p_data_size, uint32_t *r_packet_size, uint64_t *r_sender_steam_id, int p_channel) override;
+	virtual bool send_packet(uint64_t p_target_steam_id, const uint8_t *p_data, uint32_t p_data_size, SWC::P2PSend p_send_type, int p_channel) override;
+
+	HBSteamNetworkingLoopbackBackend(uint64_t p_local_steam_id = 1) :
+			local_steam_id(p_local_steam_id) {}
+};
+
 class HBSteamNetworking : public RefCounted {
 	GDCLASS(HBSteamNetworking, RefCounted);
 	ISteamNetworking *steam_networking = nullptr;
-	void _on_p2p_connection_failed(Ref<SteamworksCallbackData> p_callback);
-	void _on_p2p_session_request(Ref<SteamworksCallbackData> p_callback);
+	HBSteamNetworkingBackend *backend = nullptr;
+	bool owns_backend = false;
+	void _on_p2p_connection_failed(const SteamworksCallbackData &p_callback, bool p_io_failure);
+	void _on_p2p_session_request(const SteamworksCallbackData &p_callback, bool p_io_failure);
 
 protected:
 	static void _bind_methods();
@@ -67,9 +106,25 @@ public:
 	bool close_p2p_session_with_user(Ref<HBSteamFriend> p_user);
 	bool is_p2p_packet_available(int p_channel = 0);
 	Ref<SteamP2PPacket> read_p2p_packet(int p_channel = 0);
-	bool send_p2p_packet(Ref<HBSteamFriend> p_target_user, Vector<uint8_t> p_data, SWC::P2PSend p_send_type = SWC::P2P_SEND_RELIABLE, int p_channel = 0);
+	bool send_p2p_packet(Ref<HBSteamFriend> p_target_user, const Vector<uint8_t> &p_data, SWC::P2PSend p_send_type = SWC::P2P_SEND_RELIABLE, int p_channel = 0);
+
+	struct P2PPacketInfo {
+		uint32_t offset = 0;
+		uint32_t size = 0;
+		uint64_t sender_steam_id = 0;
+	};
+
+	// Appends every pending packet on the channel to r_buffer without per-packet allocations, returns the amount read.
+	// Both vectors keep their capacity across calls, so clearing them between frames makes draining allocation-free.
+	int drain_p2p_packets(LocalVector<uint8_t> &r_buffer, LocalVector<P2PPacketInfo> &r_packets, int p_channel = 0);
+	bool send_p2p_packet_raw(uint64_t p_target_steam_id, const uint8_t *p_data, uint32_t p_data_size, SWC::P2PSend p_send_type = SWC::P2P_SEND_RELIABLE, int p_channel = 0);
+
+	// Replaces the Steam transport, ownership is not taken.
+	void set_backend(HBSteamNetworkingBackend *p_backend);
+
 	void init_interface();
 	bool is_valid() const;
+	~HBSteamNetworking();
 };
 
 #endif // STEAM_NETWORKING_H
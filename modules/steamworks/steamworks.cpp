@@ -46,56 +46,138 @@ extern "C" void __cdecl SteamAPIDebugTextHook(int nSeverity, const char *pchDebu
 	}
 }
 
-void Steamworks::_run_callbacks() {
-	SteamAPI_ManualDispatch_RunFrame(steam_pipe);
+class SteamworksManualDispatchSource : public SteamworksCallbackSource {
+	HSteamPipe steam_pipe;
 	CallbackMsg_t msg;
-	while (SteamAPI_ManualDispatch_GetNextCallback(steam_pipe, &msg)) {
+
+public:
+	virtual void run_frame() override {
+		SteamAPI_ManualDispatch_RunFrame(steam_pipe);
+	}
+
+	virtual bool get_next_message(Message &r_message) override {
+		if (!SteamAPI_ManualDispatch_GetNextCallback(steam_pipe, &msg)) {
+			return false;
+		}
 		if (msg.m_iCallback == SteamAPICallCompleted_t::k_iCallback) {
-			SteamAPICallCompleted_t *api_call = (SteamAPICallCompleted_t *)msg.m_pubParam;
-			Ref<SteamworksCallbackData> callback_data = memnew(SteamworksCallbackData(msg));
-			bool failed;
-			bool api_call_ok = SteamAPI_ManualDispatch_GetAPICallResult(steam_pipe, api_call->m_hAsyncCall, callback_data->get_ptr(), api_call->m_cubParam, api_call->m_iCallback, &failed);
+			const SteamAPICallCompleted_t *api_call = (SteamAPICallCompleted_t *)msg.m_pubParam;
+			r_message.callback_type = api_call->m_iCallback;
+			r_message.api_call = api_call->m_hAsyncCall;
+			r_message.data = nullptr;
+			r_message.data_size = api_call->m_cubParam;
+		} else {
+			r_message.callback_type = msg.m_iCallback;
+			r_message.api_call = 0;
+			r_message.data = msg.m_pubParam;
+			r_message.data_size = msg.m_cubParam;
+		}
+		return true;
+	}
+
+	virtual bool get_api_call_result(const Message &p_message, void *r_data, bool &r_failed) override {
+		bool api_call_ok = SteamAPI_ManualDispatch_GetAPICallResult(steam_pipe, p_message.api_call, r_data, p_message.data_size, p_message.callback_type, &r_failed);
+		if (api_call_ok && r_failed) {
+			ESteamAPICallFailure failure = SteamAPI_ISteamUtils_GetAPICallFailureReason(SteamAPI_SteamUtils(), p_message.api_call);
+			ERR_PRINT(vformat("API CALL FAILED! with reason: %d", failure));
+		}
+		return api_call_ok;
+	}
+
+	virtual void free_last_message() override {
+		SteamAPI_ManualDispatch_FreeLastCallback(steam_pipe);
+	}
+
+	SteamworksManualDispatchSource(HSteamPipe p_steam_pipe) :
+			steam_pipe(p_steam_pipe) {}
+};
+
+Ref<SteamworksCallbackData> Steamworks::_acquire_callback_data(int p_callback_type, uint32_t p_size) {
+	Ref<SteamworksCallbackData> callback_data;
+	// Payloads held onto by a listener after dispatch can't be reused.
+	for (const Ref<SteamworksCallbackData> &pooled : callback_data_pool) {
+		if (pooled->get_reference_count() == 1) {
+			callback_data = pooled;
+			break;
+		}
+	}
+	if (callback_data.is_null()) {
+		callback_data.instantiate();
+		if (callback_data_pool.size() < CALLBACK_DATA_POOL_MAX_SIZE) {
+			callback_data_pool.push_back(callback_data);
+		}
+	}
+	callback_data->prepare(p_callback_type, p_size);
+	return callback_data;
+}
+
+void Steamworks::_dispatch(SteamworksCallbackInfo &p_info, const Ref<SteamworksCallbackData> &p_data, bool p_is_call_result, bool p_io_failure) {
+	// Listeners may register new callbacks while we dispatch, so entries are copied out by index.
+	for (uint32_t i = 0; i < p_info.native_callbacks.size();) {
+		const NativeCallback callback = p_info.native_callbacks[i];
+		Object *instance = ObjectDB::get_instance(callback.instance_id);
+		if (!instance) {
+			p_info.native_callbacks.remove_at(i);
+			continue;
+		}
+		callback.function(instance, **p_data, p_io_failure);
+		i++;
+	}
+
+	if (p_info.callbacks.is_empty()) {
+		return;
+	}
+
+	const Variant data_arg = p_data;
+	const Variant io_failure_arg = p_io_failure;
+	const Variant *args[2] = { &data_arg, &io_failure_arg };
+	for (uint32_t i = 0; i < p_info.callbacks.size();) {
+		const Callable callable = p_info.callbacks[i];
+		if (!callable.is_valid()) {
+			p_info.callbacks.remove_at(i);
+			continue;
+		}
+		Variant ret;
+		Callable::CallError ce;
+		// Only API call results receive the IO failure argument.
+		callable.callp(args, p_is_call_result ? 2 : 1, ret, ce);
+		i++;
+	}
+}
+
+void Steamworks::_run_callbacks() {
+	ERR_FAIL_NULL(callback_source);
+	callback_source->run_frame();
+	SteamworksCallbackSource::Message msg;
+	while (callback_source->get_next_message(msg)) {
+		if (msg.api_call != 0) {
+			SteamworksCallbackInfo *info = call_result_callbacks.getptr(msg.api_call);
+			if (!info) {
+				callback_source->free_last_message();
+				continue;
+			}
+			Ref<SteamworksCallbackData> callback_data = _acquire_callback_data(msg.callback_type, msg.data_size);
+			bool failed = false;
+			bool api_call_ok = callback_source->get_api_call_result(msg, callback_data->get_ptr(), failed);
 			if (!api_call_ok) {
-				SteamAPI_ManualDispatch_FreeLastCallback(steam_pipe);
+				callback_source->free_last_message();
 				ERR_PRINT("API call failed");
 				continue;
 			}
 
-			if (failed) {
-				ESteamAPICallFailure failure = SteamAPI_ISteamUtils_GetAPICallFailureReason(utils->get_interface(), api_call->m_hAsyncCall);
-				ERR_PRINT(vformat("API CALL FAILED! with reason: %d", failure));
-			}
-
-			if (call_result_callbacks.has(api_call->m_hAsyncCall)) {
-				SteamworksCallbackInfo &info = call_result_callbacks[api_call->m_hAsyncCall];
-				for (Callable callable : info.callbacks) {
-					if (!callable.is_valid()) {
-						// API result callbacks are one-time only.
-						continue;
-					}
-					Array args;
-					args.push_back(callback_data);
-					args.push_back(failed);
-					callable.callv(args);
-				}
-				info.callbacks.clear();
-			}
+			// API result callbacks are one-time only.
+			_dispatch(*info, callback_data, true, failed);
+			call_result_callbacks.erase(msg.api_call);
 		} else {
-			if (callback_infos.has(msg.m_iCallback)) {
-				Ref<SteamworksCallbackData> callback_data = memnew(SteamworksCallbackData(msg));
-				memcpy(callback_data->get_ptr(), msg.m_pubParam, msg.m_cubParam);
-				for (Callable callable : callback_infos[msg.m_iCallback].callbacks) {
-					if (!callable.is_valid()) {
-						continue;
-					}
-
-					Array args;
-					args.push_back(callback_data);
-					callable.callv(args);
+			SteamworksCallbackInfo *info = callback_infos.getptr(msg.callback_type);
+			if (info) {
+				Ref<SteamworksCallbackData> callback_data = _acquire_callback_data(msg.callback_type, msg.data_size);
+				if (msg.data_size > 0) {
+					memcpy(callback_data->get_ptr(), msg.data, msg.data_size);
 				}
+				_dispatch(*info, callback_data, false, false);
 			}
 		}
-		SteamAPI_ManualDispatch_FreeLastCallback(steam_pipe);
+		callback_source->free_last_message();
 	}
 }
 
@@ -145,9 +227,42 @@ void Steamworks::add_callback(int p_callback_type, Callable p_callable) {
 }
 
 void Steamworks::add_call_result_callback(ResultCallbackType p_callback_id, Callable p_callable) {
-	SteamworksCallbackInfo callback_info;
-	callback_info.callbacks.push_back(p_callable);
-	call_result_callbacks.insert(p_callback_id, callback_info);
+	if (!call_result_callbacks.has(p_callback_id)) {
+		call_result_callbacks.insert(p_callback_id, SteamworksCallbackInfo());
+	}
+	call_result_callbacks[p_callback_id].callbacks.push_back(p_callable);
+}
+
+void Steamworks::add_native_callback(int p_callback_type, Object *p_instance, NativeCallbackFunction p_function) {
+	ERR_FAIL_NULL(p_instance);
+	ERR_FAIL_NULL(p_function);
+	if (!callback_infos.has(p_callback_type)) {
+		callback_infos.insert(p_callback_type, SteamworksCallbackInfo());
+	}
+	NativeCallback callback;
+	callback.instance_id = p_instance->get_instance_id();
+	callback.function = p_function;
+	callback_infos[p_callback_type].native_callbacks.push_back(callback);
+}
+
+void Steamworks::add_native_call_result_callback(ResultCallbackType p_callback_id, Object *p_instance, NativeCallbackFunction p_function) {
+	ERR_FAIL_NULL(p_instance);
+	ERR_FAIL_NULL(p_function);
+	if (!call_result_callbacks.has(p_callback_id)) {
+		call_result_callbacks.insert(p_callback_id, SteamworksCallbackInfo());
+	}
+	NativeCallback callback;
+	callback.instance_id = p_instance->get_instance_id();
+	callback.function = p_function;
+	call_result_callbacks[p_callback_id].native_callbacks.push_back(callback);
+}
+
+void Steamworks::set_callback_source(SteamworksCallbackSource *p_callback_source) {
+	if (owns_callback_source && callback_source) {
+		memdelete(callback_source);
+	}
+	callback_source = p_callback_source;
+	owns_callback_source = false;
 }
 
 bool Steamworks::init(int p_app_id, bool p_run_callbacks_automatically) {
@@ -158,6 +273,10 @@ bool Steamworks::init(int p_app_id, bool p_run_callbacks_automatically) {
 	SW_ERR_FAIL_COND_V_MSG(!SteamAPI_Init(), false, "Steamworks: SteamApi_Init returned false. Steam isn't running, couldn't find Steam, App ID is ureleased, Don't own App ID.");
 	SteamAPI_ManualDispatch_Init();
 	steam_pipe = SteamAPI_GetHSteamPipe();
+	if (!callback_source) {
+		callback_source = memnew(SteamworksManualDispatchSource(steam_pipe));
+		owns_callback_source = true;
+	}
 	initialized = true;
 	app_id = p_app_id;
 
@@ -218,6 +337,9 @@ Steamworks::~Steamworks() {
 		utils = Ref<HBSteamUtils>();
 		SteamAPI_Shutdown();
 	}
+	if (owns_callback_source && callback_source) {
+		memdelete(callback_source);
+	}
 	singleton = nullptr;
 }
 
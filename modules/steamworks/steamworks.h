@@ -31,6 +31,7 @@
 #ifndef STEAMWORKS_H
 #define STEAMWORKS_H
 
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 #include "steam_apps.h"
 #include "steam_friends.h"
@@ -44,6 +45,26 @@
 #include "steam_utils.h"
 
 class ISteamClient;
+
+// Where Steamworks pulls callback messages from, abstracted so dispatch can be driven without the Steam client.
+class SteamworksCallbackSource {
+public:
+	struct Message {
+		int callback_type = 0;
+		// Non-zero when the message is the result of an async API call.
+		uint64_t api_call = 0;
+		// Only set for regular callbacks, API call results must be fetched with get_api_call_result.
+		const void *data = nullptr;
+		uint32_t data_size = 0;
+	};
+
+	virtual void run_frame() = 0;
+	virtual bool get_next_message(Message &r_message) = 0;
+	virtual bool get_api_call_result(const Message &p_message, void *r_data, bool &r_failed) = 0;
+	virtual void free_last_message() = 0;
+	virtual ~SteamworksCallbackSource() {}
+};
+
 class Steamworks : public Object {
 	GDCLASS(Steamworks, Object);
 
@@ -66,14 +87,38 @@ class Steamworks : public Object {
 	Ref<HBSteamUserStats> user_stats;
 	typedef int CallbackType;
 
+public:
+	typedef void (*NativeCallbackFunction)(Object *p_instance, const SteamworksCallbackData &p_data, bool p_io_failure);
+
+private:
+	struct NativeCallback {
+		ObjectID instance_id;
+		NativeCallbackFunction function = nullptr;
+	};
+
 	struct SteamworksCallbackInfo {
-		Vector<Callable> callbacks;
+		LocalVector<NativeCallback> native_callbacks;
+		LocalVector<Callable> callbacks;
 	};
 
 	typedef uint64_t ResultCallbackType;
 
 	HashMap<CallbackType, SteamworksCallbackInfo> callback_infos;
 	HashMap<ResultCallbackType, SteamworksCallbackInfo> call_result_callbacks;
+
+	SteamworksCallbackSource *callback_source = nullptr;
+	bool owns_callback_source = false;
+
+	static const uint32_t CALLBACK_DATA_POOL_MAX_SIZE = 8;
+	LocalVector<Ref<SteamworksCallbackData>> callback_data_pool;
+
+	template <typename T, void (T::*p_method)(const SteamworksCallbackData &, bool)>
+	static void _native_method_trampoline(Object *p_instance, const SteamworksCallbackData &p_data, bool p_io_failure) {
+		(static_cast<T *>(p_instance)->*p_method)(p_data, p_io_failure);
+	}
+
+	Ref<SteamworksCallbackData> _acquire_callback_data(int p_callback_type, uint32_t p_size);
+	void _dispatch(SteamworksCallbackInfo &p_info, const Ref<SteamworksCallbackData> &p_data, bool p_is_call_result, bool p_io_failure);
 	void _run_callbacks();
 	bool get_ticket_for_web_api(const String &p_identifier) const;
 
@@ -83,6 +128,24 @@ protected:
 public:
 	void add_callback(int p_callback_type, Callable p_callable);
 	void add_call_result_callback(uint64_t p_callback_id, Callable p_callable);
+
+	// Native listeners skip Variant marshalling entirely, they are dropped once their instance is freed.
+	void add_native_callback(int p_callback_type, Object *p_instance, NativeCallbackFunction p_function);
+	void add_native_call_result_callback(uint64_t p_callback_id, Object *p_instance, NativeCallbackFunction p_function);
+
+	template <typename T, void (T::*p_method)(const SteamworksCallbackData &, bool)>
+	void add_native_callback(int p_callback_type, T *p_instance) {
+		add_native_callback(p_callback_type, p_instance, &_native_method_trampoline<T, p_method>);
+	}
+
+	template <typename T, void (T::*p_method)(const SteamworksCallbackData &, bool)>
+	void add_native_call_result_callback(uint64_t p_callback_id, T *p_instance) {
+		add_native_call_result_callback(p_callback_id, p_instance, &_native_method_trampoline<T, p_method>);
+	}
+
+	// Replaces the Steam manual dispatch callback source, ownership is not taken.
+	void set_callback_source(SteamworksCallbackSource *p_callback_source);
+
 	static String last_error;
 	static String get_last_error() { return last_error; };
 	static Steamworks *get_singleton() { return singleton; }
@@ -33,24 +33,41 @@
 
 #include "core/object/ref_counted.h"
 
-struct CallbackMsg_t;
-
+// Callback payloads are pooled by Steamworks and reused between dispatches,
+// listeners that need the data after returning must keep the reference alive.
 class SteamworksCallbackData : public RefCounted {
 	void *callback_data = nullptr;
-	int callback_type;
+	uint32_t callback_data_size = 0;
+	uint32_t callback_data_capacity = 0;
+	int callback_type = 0;
 
 public:
 	void *get_ptr() {
 		return callback_data;
 	}
 
+	const void *get_ptr() const {
+		return callback_data;
+	}
+
+	uint32_t get_size() const {
+		return callback_data_size;
+	}
+
+	int get_callback_type() const {
+		return callback_type;
+	}
+
 	template <typename T>
 	const T *get_data() const {
 		DEV_ASSERT(T::k_iCallback == callback_type);
 		return (T *)callback_data;
 	};
 
-	SteamworksCallbackData(CallbackMsg_t callback_msg);
+	// Prepares the buffer for a new payload, only reallocating when it needs to grow.
+	void prepare(int p_callback_type, uint32_t p_size);
+
+	SteamworksCallbackData() {}
 	~SteamworksCallbackData() {
 		if (callback_data) {
 			memfree(callback_data);
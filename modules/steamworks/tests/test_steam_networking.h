@@ -59,6 +59,42 @@ TEST_CASE("[SteamNetworking] Test sending an receiving Steam P2P packets") {
 	CHECK_MESSAGE(packet->get_data().size() == 3, "The received P2P packet should be the same length as the sent one.");
 	CHECK_MESSAGE(packet->get_data()[1] == 2, "The received P2P packet should match the sent data.");
 }
+
+TEST_CASE("[SteamNetworking] Test draining P2P packets through the loopback backend") {
+	Ref<HBSteamNetworking> networking;
+	networking.instantiate();
+	const uint64_t local_steam_id = 76561197960287930;
+	HBSteamNetworkingLoopbackBackend loopback(local_steam_id);
+	networking->set_backend(&loopback);
+
+	const uint8_t first_packet[3] = { 1, 2, 3 };
+	const uint8_t second_packet[2] = { 4, 5 };
+	CHECK_MESSAGE(networking->send_p2p_packet_raw(local_steam_id, first_packet, 3), "The first P2P packet should have been sent.");
+	CHECK_MESSAGE(networking->send_p2p_packet_raw(local_steam_id, second_packet, 2), "The second P2P packet should have been sent.");
+	CHECK_MESSAGE(networking->send_p2p_packet_raw(local_steam_id, second_packet, 2, SWC::P2P_SEND_RELIABLE, 1), "The P2P packet on another channel should have been sent.");
+
+	LocalVector<uint8_t> buffer;
+	LocalVector<HBSteamNetworking::P2PPacketInfo> packets;
+	CHECK_MESSAGE(networking->drain_p2p_packets(buffer, packets) == 2, "Both packets on the default channel should have been drained.");
+	CHECK_MESSAGE(!networking->is_p2p_packet_available(), "No packets should be left on the default channel.");
+	CHECK_MESSAGE(networking->is_p2p_packet_available(1), "Packets on other channels should not be drained.");
+	REQUIRE(packets.size() == 2);
+	CHECK_MESSAGE(buffer.size() == 5, "The drained buffer should contain both packets back to back.");
+	CHECK(packets[0].offset == 0);
+	CHECK(packets[0].size == 3);
+	CHECK(packets[1].offset == 3);
+	CHECK(packets[1].size == 2);
+	CHECK_MESSAGE(packets[1].sender_steam_id == local_steam_id, "The drained packet's sender should be the local user.");
+	CHECK_MESSAGE(buffer[1] == 2, "The drained data should match the first sent packet.");
+	CHECK_MESSAGE(buffer[4] == 5, "The drained data should match the second sent packet.");
+
+	buffer.clear();
+	packets.clear();
+	CHECK_MESSAGE(networking->drain_p2p_packets(buffer, packets, 1) == 1, "The packet on the second channel should have been drained.");
+	CHECK(buffer[0] == 4);
+
+	networking->set_backend(nullptr);
+}
 } //namespace TestSteamNetworking
 
 #endif // TEST_STEAM_NETWORKING_H
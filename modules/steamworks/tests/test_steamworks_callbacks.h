@@ -0,0 +1,202 @@
+/**************************************************************************/
+/*  test_steamworks_callbacks.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                           EIRTeam.Steamworks                           */
+/*                         https://ph.eirteam.moe                         */
+/**************************************************************************/
+/* Copyright (c) 2023-present Álex Román (EIRTeam) & contributors.        */
+/*                                                                        */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STEAMWORKS_CALLBACKS_H
+#define TEST_STEAMWORKS_CALLBACKS_H
+
+#include "../steamworks.h"
+#include "tests/test_macros.h"
+
+namespace TestSteamworksCallbacks {
+struct FakeCallback {
+	static const int k_iCallback = 999001;
+	int value = 0;
+};
+
+struct FakeCallResult {
+	static const int k_iCallback = 999002;
+	int value = 0;
+};
+
+// Feeds queued messages to Steamworks instead of the Steam client.
+class FakeCallbackSource : public SteamworksCallbackSource {
+public:
+	struct FakeMessage {
+		Message message;
+		Vector<uint8_t> payload;
+		bool failed = false;
+	};
+	List<FakeMessage> queue;
+	FakeMessage current;
+
+	template <typename T>
+	void push_callback(const T &p_data) {
+		FakeMessage fake;
+		fake.message.callback_type = T::k_iCallback;
+		fake.payload.resize(sizeof(T));
+		memcpy(fake.payload.ptrw(), &p_data, sizeof(T));
+		fake.message.data_size = sizeof(T);
+		queue.push_back(fake);
+	}
+
+	template <typename T>
+	void push_call_result(uint64_t p_api_call, const T &p_data, bool p_failed) {
+		FakeMessage fake;
+		fake.message.callback_type = T::k_iCallback;
+		fake.message.api_call = p_api_call;
+		fake.payload.resize(sizeof(T));
+		memcpy(fake.payload.ptrw(), &p_data, sizeof(T));
+		fake.message.data_size = sizeof(T);
+		fake.failed = p_failed;
+		queue.push_back(fake);
+	}
+
+	virtual void run_frame() override {}
+
+	virtual bool get_next_message(Message &r_message) override {
+		if (queue.is_empty()) {
+			return false;
+		}
+		current = queue.front()->get();
+		queue.pop_front();
+		r_message = current.message;
+		if (r_message.api_call == 0) {
+			r_message.data = current.payload.ptr();
+		}
+		return true;
+	}
+
+	virtual bool get_api_call_result(const Message &p_message, void *r_data, bool &r_failed) override {
+		memcpy(r_data, current.payload.ptr(), current.payload.size());
+		r_failed = current.failed;
+		return true;
+	}
+
+	virtual void free_last_message() override {}
+};
+
+class FakeCallbackListener : public Object {
+public:
+	int callback_count = 0;
+	int last_value = 0;
+	bool last_io_failure = false;
+	const void *last_data_ptr = nullptr;
+
+	void _on_fake_callback(const SteamworksCallbackData &p_data, bool p_io_failure) {
+		callback_count++;
+		last_value = p_data.get_data<FakeCallback>()->value;
+		last_data_ptr = p_data.get_ptr();
+	}
+
+	void _on_fake_call_result(const SteamworksCallbackData &p_data, bool p_io_failure) {
+		callback_count++;
+		last_value = p_data.get_data<FakeCallResult>()->value;
+		last_io_failure = p_io_failure;
+	}
+
+	void _on_fake_call_result_callable(Ref<SteamworksCallbackData> p_data, bool p_io_failure) {
+		callback_count++;
+		last_value = p_data->get_data<FakeCallResult>()->value;
+		last_io_failure = p_io_failure;
+	}
+};
+
+static Steamworks *recreate_uninitialized_steamworks() {
+	// Hack-ish, deinit steamworks first so no real callbacks get in the way.
+	if (Steamworks::get_singleton() != nullptr) {
+		memdelete(Steamworks::get_singleton());
+	}
+	return memnew(Steamworks);
+}
+
+TEST_CASE("[Steamworks] Native callbacks are dispatched from a fake callback source") {
+	Steamworks *steamworks = recreate_uninitialized_steamworks();
+	FakeCallbackSource source;
+	steamworks->set_callback_source(&source);
+
+	FakeCallbackListener *listener = memnew(FakeCallbackListener);
+	steamworks->add_native_callback<FakeCallbackListener, &FakeCallbackListener::_on_fake_callback>(FakeCallback::k_iCallback, listener);
+
+	FakeCallback callback;
+	callback.value = 42;
+	source.push_callback(callback);
+	steamworks->run_callbacks();
+	CHECK_MESSAGE(listener->callback_count == 1, "The native listener should have been called once.");
+	CHECK_MESSAGE(listener->last_value == 42, "The native listener should receive the callback payload.");
+
+	const void *first_data_ptr = listener->last_data_ptr;
+	callback.value = 7;
+	source.push_callback(callback);
+	steamworks->run_callbacks();
+	CHECK_MESSAGE(listener->callback_count == 2, "The native listener should have been called twice.");
+	CHECK_MESSAGE(listener->last_value == 7, "The native listener should receive the new callback payload.");
+	CHECK_MESSAGE(listener->last_data_ptr == first_data_ptr, "Callback payload buffers should be reused between dispatches.");
+
+	memdelete(listener);
+	source.push_callback(callback);
+	// Freed listeners must be skipped rather than called.
+	steamworks->run_callbacks();
+
+	steamworks->set_callback_source(nullptr);
+	recreate_uninitialized_steamworks();
+}
+
+TEST_CASE("[Steamworks] Call results are dispatched once to native and callable listeners") {
+	Steamworks *steamworks = recreate_uninitialized_steamworks();
+	FakeCallbackSource source;
+	steamworks->set_callback_source(&source);
+
+	const uint64_t api_call = 1234;
+	FakeCallbackListener *native_listener = memnew(FakeCallbackListener);
+	FakeCallbackListener *callable_listener = memnew(FakeCallbackListener);
+	steamworks->add_native_call_result_callback<FakeCallbackListener, &FakeCallbackListener::_on_fake_call_result>(api_call, native_listener);
+	steamworks->add_call_result_callback(api_call, callable_mp(callable_listener, &FakeCallbackListener::_on_fake_call_result_callable));
+
+	FakeCallResult result;
+	result.value = 13;
+	source.push_call_result(api_call, result, true);
+	source.push_call_result(api_call, result, true);
+	steamworks->run_callbacks();
+
+	CHECK_MESSAGE(native_listener->callback_count == 1, "The native call result listener should have been called exactly once.");
+	CHECK_MESSAGE(native_listener->last_value == 13, "The native call result listener should receive the result payload.");
+	CHECK_MESSAGE(native_listener->last_io_failure, "The native call result listener should receive the IO failure flag.");
+	CHECK_MESSAGE(callable_listener->callback_count == 1, "The callable call result listener should have been called exactly once.");
+	CHECK_MESSAGE(callable_listener->last_value == 13, "The callable call result listener should receive the result payload.");
+	CHECK_MESSAGE(callable_listener->last_io_failure, "The callable call result listener should receive the IO failure flag.");
+
+	memdelete(native_listener);
+	memdelete(callable_listener);
+	steamworks->set_callback_source(nullptr);
+	recreate_uninitialized_steamworks();
+}
+} //namespace TestSteamworksCallbacks
+
+#endif // TEST_STEAMWORKS_CALLBACKS_H
@@ -509,7 +509,11 @@ void Builder::add_collider_from_mesh(Node3D* node, Ref<ArrayMesh>& mesh, Collide
 		case ColliderShape::Convex: mesh_shape = mesh->create_convex_shape(); break;
 		case ColliderShape::Concave: {
 			Ref<ConcavePolygonShape3D> conc = mesh->create_trimesh_shape();
-			conc->set_backface_collision_enabled(true);
+			if (conc.is_valid()) {
+				conc->set_backface_collision_enabled(true);
+				// Saved along with the map so the physics server doesn't have to rebuild it on load
+				conc->bake_physics_cache();
+			}
 			mesh_shape = conc;
 		} break;
 	}